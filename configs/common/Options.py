@@ -68,6 +68,11 @@ def addNoISAOptions(parser):
                       default='1.0V',
                       help = """Top-level voltage for blocks running at system
                       power supply""")
+    parser.add_option("--sim-quantum", type="string", default=None,
+                      help="""Simulation quantum for --partition-cpus and
+                      --network-partitions, also the minimum latency of
+                      anything crossing between event queues [Default:
+                      the shortest latency that crosses]""")
     parser.add_option("--sys-clock", action="store", type="string",
                       default='1GHz',
                       help = """Top-level clock for blocks running at system
@@ -169,6 +174,10 @@ def addCommonOptions(parser):
                       Elastic Trace probe in a capture simulation and
                       Trace CPU in a replay simulation""", default="")
 
+    parser.add_option("--partition-cpus", action="store_true",
+                      help="""Simulate each CPU on its own event queue and
+                      thread (classic memory system only)""")
+
     parser.add_option("-l", "--lpae", action="store_true")
     parser.add_option("-V", "--virtualisation", action="store_true")
 
@@ -233,6 +242,9 @@ def addCommonOptions(parser):
                       help="Enable basic block profiling for SimPoints")
     parser.add_option("--simpoint-interval", type="int", default=10000000,
                       help="SimPoint interval in num of instructions")
+    parser.add_option("--simpoint-max-k", type="int", default=0,
+        help="Cluster the profile into at most this many SimPoints on " \
+             "exit, see simpoint.simpts and simpoint.weights (0: don't)")
     parser.add_option("--take-simpoint-checkpoints", action="store", type="string",
         help="<simpoint file,weight file,interval-length,warmup-length>")
     parser.add_option("--restore-simpoint-checkpoint", action="store_true",
@@ -275,6 +287,24 @@ def addCommonOptions(parser):
     parser.add_option("-p", "--prog-interval", type="str",
         help="CPU Progress Interval")
 
+    # Fork based sampling
+    parser.add_option("--fork-sample-window", action="store", type="int",
+        default=None,
+        help="""Fast-forward with --restore-with-cpu and measure samples
+                of <N> ticks with --cpu-type in forked simulators, at
+                m5_checkpoint pseudo-ops and every --fork-sample-period
+                ticks""")
+    parser.add_option("--fork-sample-period", action="store", type="int",
+        default=None,
+        help="Ticks between fork samples")
+    parser.add_option("--fork-sample-warmup", action="store", type="int",
+        default=0,
+        help="Ticks to warm up the detailed CPU before each fork sample")
+    parser.add_option("--fork-max-samples-running", action="store",
+        type="int", default=None,
+        help="Maximum number of fork samples running at once " \
+             "[Default: number of host CPUs]")
+
     # Fastforwarding and simpoint related materials
     parser.add_option("-W", "--warmup-insts", action="store", type="int",
         default=None,
@@ -0,0 +1,253 @@
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from __future__ import print_function
+
+import m5
+from m5.objects import *
+from m5.params import PortRef, VectorPortRef
+from m5.proxy import isproxy
+
+# Split a classic-memory multicore into one event queue per core plus
+# one shared event queue for the memory system and devices, so that
+# each core is simulated by its own thread.
+#
+# The caches, including the first-level ones, stay on the shared event
+# queue: a timing snoop has to be answered before the crossbar moves
+# on, which a cache on another thread could only do at whatever point
+# its thread has reached. A ThreadBridge is spliced in between the
+# core and every cache or crossbar it is connected to, and on any other
+# connection between the core and the rest of the system (interrupts,
+# uncached walkers). Snoops are handed to the core a quantum late,
+# which only affects its LL/SC and load ordering checks. The bridges
+# add at least one simulation quantum of latency, so the quantum
+# defaults to the shortest latency of the objects right below the cut.
+
+def _to_ticks(value):
+    # Converting to ticks needs the tick frequency to be settled
+    m5.ticks.fixGlobalFrequency()
+    return m5.ticks.fromSeconds(m5.util.convert.anyToLatency(value))
+
+def _clock_period(obj):
+    """Clock period of an object in ticks"""
+    while isproxy(obj.clk_domain):
+        obj = obj._parent
+    domain = obj.clk_domain
+    divider = 1
+    while isinstance(domain, DerivedClockDomain):
+        divider *= int(domain.clk_divider)
+        domain = domain.clk_domain
+    m5.ticks.fixGlobalFrequency()
+    return divider * domain.clock[0].getValue()
+
+def _cycles(obj, *params):
+    values = [ getattr(obj, p) for p in params ]
+    if any(isproxy(v) for v in values):
+        return None
+    return sum(int(v) for v in values)
+
+def _hop_latency(obj):
+    """Shortest time in ticks that a packet from or to a core spends
+    in a memory object right below the cut, or None if unknown."""
+
+    if isinstance(obj, BaseXBar):
+        latencies = [ _cycles(obj, 'frontend_latency', 'forward_latency'),
+                      _cycles(obj, 'response_latency') ]
+    elif isinstance(obj, BaseCache):
+        latencies = [ _cycles(obj, 'tag_latency'),
+                      _cycles(obj, 'response_latency') ]
+    else:
+        return None
+
+    latencies = [ l for l in latencies if l is not None ]
+    if not latencies:
+        return None
+    return max(1, min(latencies)) * _clock_period(obj)
+
+def _port_refs(obj):
+    for ref in obj._port_refs.values():
+        if isinstance(ref, VectorPortRef):
+            for el in ref.elements:
+                yield el
+        else:
+            yield ref
+
+def _peer(ref):
+    if isinstance(ref.peer, PortRef):
+        return ref.peer.simobj
+    return None
+
+def _split(cpu):
+    """Return the objects of a CPU subtree that belong to the core,
+    i.e. everything but the caches and crossbars, and those that belong
+    to the memory system."""
+
+    objs = list(cpu.descendants())
+    mem_side = set()
+    for obj in objs:
+        if isinstance(obj, (BaseCache, BaseXBar)):
+            mem_side.update(id(o) for o in obj.descendants())
+
+    core = [ o for o in objs if id(o) not in mem_side ]
+    mem = [ o for o in objs if id(o) in mem_side ]
+    return core, mem
+
+def partition_cpus(system, cpus, shared_eq=0):
+    """Put every CPU in cpus on its own event queue and bridge all their connections to the rest of the
+    system. Must be called after the caches have been connected.
+    Returns the number of event queues and the shortest latency in
+    ticks of the objects right below the cut, or None if unknown."""
+
+    bridges = []
+    latencies = []
+    for idx, cpu in enumerate(cpus):
+        cpu_eq = shared_eq + 1 + idx
+        core, mem = _split(cpu)
+
+        for obj in mem:
+            obj.eventq_index = shared_eq
+        for obj in core:
+            obj.eventq_index = cpu_eq
+
+        core_ids = set(id(o) for o in core)
+        for obj in core:
+            for ref in list(_port_refs(obj)):
+                peer = _peer(ref)
+                if peer is None or id(peer) in core_ids:
+                    continue
+
+                latency = _hop_latency(peer)
+                if latency is not None:
+                    latencies.append(latency)
+
+                if ref.role == 'MASTER':
+                    bridge = ThreadBridge(eventq_index=cpu_eq,
+                                          master_eventq_index=shared_eq)
+                else:
+                    bridge = ThreadBridge(eventq_index=shared_eq,
+                                          master_eventq_index=cpu_eq)
+                ref.splice(bridge.master, bridge.slave)
+                bridges.append(bridge)
+
+    system.thread_bridges = bridges
+    return shared_eq + 1 + len(cpus), min(latencies) if latencies else None
+
+def config_partition(options, root, system):
+    if not options.partition_cpus:
+        return
+
+    if options.ruby:
+        m5.util.fatal("CPU partitioning requires the classic memory system")
+
+    num_queues, latency = partition_cpus(system, system.cpu)
+    if options.sim_quantum:
+        root.sim_quantum = _to_ticks(options.sim_quantum)
+    elif latency is not None:
+        root.sim_quantum = latency
+    else:
+        m5.util.fatal("Can't tell the latency below the CPUs, "
+                      "set --sim-quantum")
+
+    m5.util.inform("Simulating %d event queues with a %d tick quantum",
+                   num_queues, root.sim_quantum)
+
+# Split a garnet network into bands of routers with consecutive ids,
+# each band on its own event queue. The controllers and the network
+# interfaces stay on the shared event queue. Flits and credits that
+# cross between event queues are handed over at quantum barriers. By
+# default the quantum is the shortest link latency between two queues,
+# which keeps the timing of a single queue run. The links to the
+# network interfaces are usually a cycle long, so the threads then
+# synchronize every cycle. A longer --sim-quantum makes them
+# synchronize less often, at the cost of delaying the flits that
+# arrive within a quantum to its end.
+#
+# The simple network can't be split: controllers enqueue straight into
+# the switches' input buffers, so there is no link latency to cover
+# the hop to another event queue.
+
+def _router_queues(routers, partitions, shared_eq):
+    queues = {}
+    for idx, router in enumerate(sorted(routers, key=lambda r: r.router_id)):
+        queues[router.router_id] = \
+            shared_eq + 1 + idx * partitions // len(routers)
+    return queues
+
+def partition_network(network, partitions, shared_eq=0):
+    """Put the routers and links of a garnet network on partitions event
+    queues after shared_eq. Returns the shortest latency, in cycles, of
+    a link between two event queues or None if there is none."""
+
+    queues = _router_queues(network.routers, partitions, shared_eq)
+    for router in network.routers:
+        router.eventq_index = queues[router.router_id]
+
+    crossing = []
+    for link in network.int_links:
+        src_eq = queues[link.src_node.router_id]
+        dst_eq = queues[link.dst_node.router_id]
+        link.network_link.eventq_index = src_eq
+        link.credit_link.eventq_index = dst_eq
+        if src_eq != dst_eq:
+            crossing.append(int(link.latency))
+
+    for link in network.ext_links:
+        router_eq = queues[link.int_node.router_id]
+        # In: network interface to router, Out: router to network
+        # interface. Credits flow the other way.
+        link.network_links[0].eventq_index = shared_eq
+        link.credit_links[0].eventq_index = router_eq
+        link.network_links[1].eventq_index = router_eq
+        link.credit_links[1].eventq_index = shared_eq
+        crossing.append(int(link.latency))
+
+    return min(crossing) if crossing else None
+
+def config_network_partition(options, root, network):
+    if not options.network_partitions:
+        return
+
+    if not isinstance(network, GarnetNetwork):
+        m5.util.fatal("Only garnet networks can be partitioned")
+    if options.network_partitions > len(network.routers):
+        m5.util.fatal("More network partitions than routers")
+
+    latency = partition_network(network, options.network_partitions)
+    if latency is None:
+        return
+
+    latency *= _to_ticks(options.ruby_clock)
+    if options.sim_quantum:
+        root.sim_quantum = _to_ticks(options.sim_quantum)
+        if root.sim_quantum > latency:
+            m5.util.inform("The quantum is longer than the shortest "
+                           "link between event queues, flits on it "
+                           "arrive at the end of the quantum")
+    else:
+        root.sim_quantum = latency
+    m5.util.inform("Simulating the network on %d event queues with a "
+                   "%d tick quantum", options.network_partitions + 1,
+                   root.sim_quantum)
@@ -80,10 +80,11 @@ def setCPUClass(options):
         if options.restore_with_cpu != options.cpu_type:
             CPUClass = TmpClass
             TmpClass, test_mem_mode = getCPUClass(options.restore_with_cpu)
-    elif options.fast_forward:
+    elif options.fast_forward or options.fork_sample_window:
         CPUClass = TmpClass
-        TmpClass = AtomicSimpleCPU
-        test_mem_mode = 'atomic'
+        TmpClass = getCPUClass(options.restore_with_cpu)[0] \
+                   if options.fork_sample_window else AtomicSimpleCPU
+        test_mem_mode = TmpClass.memory_mode()
 
     # Ruby only supports atomic accesses in noncaching mode
     if test_mem_mode == 'atomic' and options.ruby:
@@ -428,6 +429,44 @@ def repeatSwitch(testsys, repeat_switch_cpu_list, maxtick, switch_freq):
             exit_event = m5.simulate(maxtick - m5.curTick())
             return exit_event
 
+def forkSampling(options, maxtick, testsys, switch_cpu_list):
+    """Fast-forward, and measure samples with the detailed CPUs in
+    forked simulators while doing so"""
+
+    print("Fork sampling %d ticks at m5_checkpoint" %
+          options.fork_sample_window, end="")
+    if options.fork_sample_period:
+        print(" and every %d ticks" % options.fork_sample_period, end="")
+    print()
+
+    samples = 0
+    while m5.curTick() < maxtick:
+        ticks = maxtick - m5.curTick()
+        if options.fork_sample_period:
+            ticks = min(ticks, options.fork_sample_period)
+        exit_event = m5.simulate(ticks)
+        exit_cause = exit_event.getCause()
+
+        if exit_cause != "simulate() limit reached" and \
+           exit_cause != "checkpoint":
+            break
+        if exit_cause == "simulate() limit reached" and \
+           not options.fork_sample_period:
+            break
+
+        print("Forking sample %d @ tick %i" % (samples, m5.curTick()))
+        m5.forkSample(testsys, switch_cpu_list, options.fork_sample_window,
+                      warmup=options.fork_sample_warmup,
+                      max_running=options.fork_max_samples_running)
+        samples += 1
+
+    for pid, status in m5.waitForkedSamples():
+        if status != 0:
+            warn("Fork sample %d exited with status %d" % (pid, status))
+    print("Took %d fork samples" % samples)
+
+    return exit_event
+
 def run(options, root, testsys, cpu_class):
     if options.checkpoint_dir:
         cptdir = options.checkpoint_dir
@@ -448,6 +487,12 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if options.fork_sample_window and \
+       (options.fast_forward or options.standard_switch or
+        options.repeat_switch or options.take_checkpoints):
+        fatal("Can't fork samples with --fast-forward, --standard-switch, "
+              "--repeat-switch or --take-checkpoints")
+
     np = options.num_cpus
     switch_cpus = None
 
@@ -642,7 +687,8 @@ def run(options, root, testsys, cpu_class):
         fatal("Bad maxtick (%d) specified: " \
               "Checkpoint starts starts from tick: %d", maxtick, cpt_starttick)
 
-    if options.standard_switch or cpu_class:
+    if (options.standard_switch or cpu_class) and \
+       not options.fork_sample_window:
         if options.standard_switch:
             print("Switch at instruction count:%s" %
                     str(testsys.cpu[0].max_insts_any_thread))
@@ -699,6 +745,10 @@ def run(options, root, testsys, cpu_class):
     elif options.restore_simpoint_checkpoint != None:
         restoreSimpointCheckpoint()
 
+    elif options.fork_sample_window:
+        exit_event = forkSampling(options, maxtick, testsys,
+                                  switch_cpu_list)
+
     else:
         if options.fast_forward:
             m5.stats.reset()
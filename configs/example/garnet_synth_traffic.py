@@ -37,6 +37,7 @@ import os, optparse, sys
 addToPath('../')
 
 from common import Options
+from common import PartitionConfig
 from ruby import Ruby
 
 # Get paths we might need.  It's expected this file is in m5/configs/example.
@@ -148,6 +149,8 @@ root.system.mem_mode = 'timing'
 # Not much point in this being higher than the L1 latency
 m5.ticks.setGlobalFrequency('1ns')
 
+PartitionConfig.config_network_partition(options, root, system.ruby.network)
+
 # instantiate configuration
 m5.instantiate()
 
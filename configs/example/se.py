@@ -62,6 +62,7 @@ from common import Simulation
 from common import CacheConfig
 from common import CpuConfig
 from common import MemConfig
+from common import PartitionConfig
 from common.Caches import *
 from common.cpu2000 import *
 
@@ -249,7 +250,8 @@ for i in xrange(np):
         system.cpu[i].workload = multiprocesses[i]
 
     if options.simpoint_profile:
-        system.cpu[i].addSimPointProbe(options.simpoint_interval)
+        system.cpu[i].addSimPointProbe(options.simpoint_interval,
+            options.simpoint_max_k)
 
     if options.checker:
         system.cpu[i].addCheckerCpu()
@@ -287,4 +289,8 @@ else:
     MemConfig.config_mem(options, system)
 
 root = Root(full_system = False, system = system)
+PartitionConfig.config_partition(options, root, system)
+if options.ruby:
+    PartitionConfig.config_network_partition(options, root,
+                                             system.ruby.network)
 Simulation.run(options, root, system, FutureClass)
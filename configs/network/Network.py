@@ -73,6 +73,9 @@ def define_options(parser):
     parser.add_option("--garnet-deadlock-threshold", action="store",
                       type="int", default=50000,
                       help="network-level deadlock threshold.")
+    parser.add_option("--network-partitions", type="int", default=0,
+                      help="""Simulate the garnet routers on this many
+                      extra event queues and threads""")
 
 
 def create_network(options, ruby):
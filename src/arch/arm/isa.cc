@@ -1636,7 +1636,7 @@ ISA::setMiscReg(int misc_reg, const MiscReg &val, ThreadContext *tc)
               // with unexpected atomic snoop requests.
               warn("Translating via MISCREG(%d) in functional mode! Fix Me!\n", misc_reg);
 
-              auto req = std::make_shared<Request>(
+              auto req = makeRequest(
                   0, val, 0, flags,  Request::funcMasterId,
                   tc->pcState().pc(), tc->contextId());
 
@@ -1818,7 +1818,7 @@ ISA::setMiscReg(int misc_reg, const MiscReg &val, ThreadContext *tc)
           case MISCREG_AT_S1E3R_Xt:
           case MISCREG_AT_S1E3W_Xt:
             {
-                RequestPtr req = std::make_shared<Request>();
+                RequestPtr req = makeRequest();
                 Request::Flags flags = 0;
                 BaseTLB::Mode mode = BaseTLB::Read;
                 TLB::ArmTranslationType tranType = TLB::NormalTran;
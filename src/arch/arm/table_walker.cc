@@ -2024,7 +2024,7 @@ TableWalker::fetchDescriptor(Addr descAddr, uint8_t *data, int numBytes,
                            currState->tc->getCpuPtr()->clockPeriod(), flags);
             (this->*doDescriptor)();
         } else {
-            RequestPtr req = std::make_shared<Request>(
+            RequestPtr req = makeRequest(
                 descAddr, numBytes, flags, masterId);
 
             req->taskId(ContextSwitchTaskId::DMA);
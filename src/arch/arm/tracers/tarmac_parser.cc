@@ -765,7 +765,7 @@ TarmacParserRecord::TarmacParserRecord(Tick _when, ThreadContext *_thread,
       parsingStarted(false), mismatch(false),
       mismatchOnPcOrOpcode(false), parent(_parent)
 {
-    memReq = std::make_shared<Request>();
+    memReq = makeRequest();
 }
 
 void
@@ -229,6 +229,8 @@ class Decoder
     AddrCacheMap addrCacheMap;
 
     DecodeCache::InstMap<ExtMachInst> *instMap;
+    /** The m5Reg the decoder was last set up for */
+    CacheKey context;
     typedef std::unordered_map<
             CacheKey, DecodeCache::InstMap<ExtMachInst> *> InstCacheMap;
     static InstCacheMap instCacheMap;
@@ -256,6 +258,7 @@ class Decoder
         instBytes = &dummy;
         decodePages = NULL;
         instMap = NULL;
+        context = 0;
     }
 
     void setM5Reg(HandyM5Reg m5Reg)
@@ -269,6 +272,7 @@ class Decoder
         altAddr = m5Reg.altAddr;
         defAddr = m5Reg.defAddr;
         stack = m5Reg.stack;
+        context = m5Reg;
 
         AddrCacheMap::iterator amIter = addrCacheMap.find(m5Reg);
         if (amIter != addrCacheMap.end()) {
@@ -298,8 +302,15 @@ class Decoder
         altAddr = old->altAddr;
         defAddr = old->defAddr;
         stack = old->stack;
+        context = old->context;
     }
 
+    /**
+     * Get a key for the state instructions are decoded in. Decoding
+     * the same bytes with the same key gives the same instruction.
+     */
+    CacheKey decodeContext() const { return context; }
+
     void reset()
     {
         state = ResetState;
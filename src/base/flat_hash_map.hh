@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_FLAT_HASH_MAP_HH__
+#define __BASE_FLAT_HASH_MAP_HH__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * Open-addressing hash map using Robin Hood hashing.
+ *
+ * Entries live in a single power-of-two sized array, next to a byte
+ * per slot holding the distance of the entry from its home slot (0
+ * for an empty slot). Insertion displaces entries that are closer to
+ * home than the one being inserted, which keeps probe sequences
+ * short, and lookups stop as soon as they reach an entry closer to
+ * home than the key could be. Erasing shifts the following entries
+ * of the cluster back by one slot, so there are no tombstones.
+ *
+ * Hash values are scrambled with a multiplicative hash before use,
+ * so identity hashes of aligned addresses or pointers are fine.
+ *
+ * Unlike std::unordered_map, any insertion or erasure invalidates
+ * all iterators and references. Key and T must be default
+ * constructible and move assignable; empty slots hold default
+ * constructed values. Probe distances are kept in a byte, so the
+ * hash must not map more than a couple of hundred keys to the same
+ * value.
+ *
+ * @tparam Key Key type
+ * @tparam T Mapped type
+ * @tparam Hash Hash function for keys
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>>
+class FlatHashMap
+{
+  public:
+    typedef Key key_type;
+    typedef T mapped_type;
+    /** Keys must not be modified through iterators. */
+    typedef std::pair<Key, T> value_type;
+    typedef size_t size_type;
+
+  private:
+    template <typename Map, typename Value>
+    class Iterator
+    {
+      private:
+        friend class FlatHashMap;
+
+        Map *map;
+        size_t idx;
+
+        Iterator(Map *_map, size_t _idx) : map(_map), idx(_idx)
+        {
+            skipEmpty();
+        }
+
+        void
+        skipEmpty()
+        {
+            while (idx < map->dists.size() && !map->dists[idx])
+                ++idx;
+        }
+
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename FlatHashMap::value_type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef Value *pointer;
+        typedef Value &reference;
+
+        Iterator() : map(nullptr), idx(0) {}
+
+        /** Iterators convert to const iterators. */
+        template <typename OtherMap, typename OtherValue>
+        Iterator(const Iterator<OtherMap, OtherValue> &other)
+            : map(other.map), idx(other.idx)
+        {}
+
+        reference operator*() const { return map->slots[idx]; }
+        pointer operator->() const { return &map->slots[idx]; }
+
+        Iterator &
+        operator++()
+        {
+            ++idx;
+            skipEmpty();
+            return *this;
+        }
+
+        Iterator
+        operator++(int)
+        {
+            Iterator it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const Iterator &other) const
+        { return idx == other.idx; }
+        bool operator!=(const Iterator &other) const
+        { return idx != other.idx; }
+
+        template <typename, typename> friend class Iterator;
+    };
+
+  public:
+    typedef Iterator<FlatHashMap, value_type> iterator;
+    typedef Iterator<const FlatHashMap, const value_type> const_iterator;
+
+    FlatHashMap() : numEntries(0), shift(64) {}
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, slots.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, slots.size()); }
+
+    size_t size() const { return numEntries; }
+    bool empty() const { return numEntries == 0; }
+
+    void
+    clear()
+    {
+        slots.clear();
+        dists.clear();
+        numEntries = 0;
+        shift = 64;
+    }
+
+    /** Make room for a number of entries without growing. */
+    void
+    reserve(size_t n)
+    {
+        size_t capacity = MinCapacity;
+        while (!fits(n, capacity))
+            capacity *= 2;
+        if (capacity > slots.size())
+            rehash(capacity);
+    }
+
+    iterator
+    find(const Key &key)
+    {
+        return iterator(this, lookup(key));
+    }
+
+    const_iterator
+    find(const Key &key) const
+    {
+        return const_iterator(this, lookup(key));
+    }
+
+    size_t
+    count(const Key &key) const
+    {
+        return lookup(key) != slots.size();
+    }
+
+    /**
+     * Insert an entry unless the key is already present.
+     *
+     * @return The entry for the key and true if it was inserted
+     */
+    template <typename... Args>
+    std::pair<iterator, bool>
+    emplace(const Key &key, Args&&... args)
+    {
+        size_t idx = lookup(key);
+        if (idx != slots.size())
+            return std::make_pair(iterator(this, idx), false);
+
+        if (!fits(numEntries + 1, slots.size()))
+            rehash(slots.empty() ? MinCapacity : slots.size() * 2);
+
+        idx = place(value_type(key, T(std::forward<Args>(args)...)));
+        return std::make_pair(iterator(this, idx), true);
+    }
+
+    std::pair<iterator, bool>
+    insert(const value_type &value)
+    {
+        return emplace(value.first, value.second);
+    }
+
+    T &
+    operator[](const Key &key)
+    {
+        return emplace(key).first->second;
+    }
+
+    /** Remove the entry an iterator points to. */
+    void
+    erase(const_iterator it)
+    {
+        assert(it.map == this && it.idx < slots.size() && dists[it.idx]);
+        remove(it.idx);
+    }
+
+    /** @return The number of entries removed */
+    size_t
+    erase(const Key &key)
+    {
+        size_t idx = lookup(key);
+        if (idx == slots.size())
+            return 0;
+        remove(idx);
+        return 1;
+    }
+
+  private:
+    static const size_t MinCapacity = 8;
+
+    /** Distances are stored in a byte, with 0 meaning empty. */
+    static const uint8_t MaxDist = 255;
+
+    std::vector<value_type> slots;
+    std::vector<uint8_t> dists;
+    size_t numEntries;
+
+    /** Shift turning a scrambled hash into a slot index */
+    unsigned shift;
+
+    Hash hasher;
+
+    /** Keep the load factor at or below 7/8. */
+    static bool
+    fits(size_t n, size_t capacity)
+    {
+        return n <= capacity - capacity / 8;
+    }
+
+    size_t
+    home(const Key &key) const
+    {
+        return (uint64_t(hasher(key)) * 0x9e3779b97f4a7c15ULL) >> shift;
+    }
+
+    size_t mask() const { return slots.size() - 1; }
+
+    /** @return The slot holding the key, or slots.size() */
+    size_t
+    lookup(const Key &key) const
+    {
+        if (numEntries == 0)
+            return slots.size();
+
+        size_t idx = home(key);
+        for (uint8_t dist = 1; dist <= dists[idx]; ++dist) {
+            if (dists[idx] == dist && slots[idx].first == key)
+                return idx;
+            idx = (idx + 1) & mask();
+        }
+        return slots.size();
+    }
+
+    /**
+     * Put an entry whose key is not in the map in its slot, growing
+     * the map if its probe sequence gets too long.
+     *
+     * @return The slot the entry ended up in
+     */
+    size_t
+    place(value_type value)
+    {
+        size_t idx = home(value.first);
+        size_t placed = slots.size();
+        uint8_t dist = 1;
+        while (dists[idx]) {
+            if (dists[idx] < dist) {
+                // take the slot from an entry that is closer to home
+                std::swap(value, slots[idx]);
+                std::swap(dist, dists[idx]);
+                if (placed == slots.size())
+                    placed = idx;
+            }
+            idx = (idx + 1) & mask();
+            if (++dist == MaxDist) {
+                // probe sequences are too long, grow and start again
+                // with the entry that is still homeless
+                Key key = placed == slots.size() ? value.first :
+                    slots[placed].first;
+                rehash(slots.size() * 2);
+                place(std::move(value));
+                return lookup(key);
+            }
+        }
+
+        slots[idx] = std::move(value);
+        dists[idx] = dist;
+        ++numEntries;
+        return placed == slots.size() ? idx : placed;
+    }
+
+    void
+    remove(size_t idx)
+    {
+        // shift the rest of the cluster back, as long as the entries
+        // are not in their home slot
+        size_t next = (idx + 1) & mask();
+        while (dists[next] > 1) {
+            slots[idx] = std::move(slots[next]);
+            dists[idx] = dists[next] - 1;
+            idx = next;
+            next = (next + 1) & mask();
+        }
+
+        slots[idx] = value_type();
+        dists[idx] = 0;
+        --numEntries;
+    }
+
+    void
+    rehash(size_t capacity)
+    {
+        assert((capacity & (capacity - 1)) == 0);
+
+        std::vector<value_type> old_slots(capacity);
+        std::vector<uint8_t> old_dists(capacity, 0);
+        old_slots.swap(slots);
+        old_dists.swap(dists);
+        numEntries = 0;
+
+        shift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1)
+            --shift;
+
+        for (size_t i = 0; i < old_slots.size(); ++i) {
+            if (old_dists[i])
+                place(std::move(old_slots[i]));
+        }
+    }
+};
+
+#endif // __BASE_FLAT_HASH_MAP_HH__
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "base/flat_hash_map.hh"
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    FlatHashMap<uint64_t, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(42), map.end());
+
+    auto res = map.emplace(42, 1);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(res.first->first, 42);
+    EXPECT_EQ(res.first->second, 1);
+
+    // existing entries are not overwritten
+    res = map.emplace(42, 2);
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ(res.first->second, 1);
+
+    map[7] = 3;
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.count(7), 1);
+    EXPECT_EQ(map.find(7)->second, 3);
+
+    EXPECT_EQ(map.erase(42), 1);
+    EXPECT_EQ(map.erase(42), 0);
+    EXPECT_EQ(map.find(42), map.end());
+
+    map.erase(map.find(7));
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(FlatHashMapTest, AlignedKeys)
+{
+    // cache line addresses only differ in their upper bits
+    FlatHashMap<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 10000; ++i)
+        map[i << 6] = i;
+
+    EXPECT_EQ(map.size(), 10000);
+    for (uint64_t i = 0; i < 10000; ++i) {
+        auto it = map.find(i << 6);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it->second, i);
+    }
+}
+
+TEST(FlatHashMapTest, Iteration)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[i] = i * 2;
+
+    int visited = 0;
+    for (const auto &entry : map) {
+        EXPECT_EQ(entry.second, entry.first * 2);
+        ++visited;
+    }
+    EXPECT_EQ(visited, 100);
+
+    const FlatHashMap<int, int> &const_map = map;
+    FlatHashMap<int, int>::const_iterator it = map.find(5);
+    EXPECT_EQ(it, const_map.find(5));
+    EXPECT_NE(it, const_map.end());
+}
+
+TEST(FlatHashMapTest, ErasedValuesAreReleased)
+{
+    FlatHashMap<int, std::shared_ptr<int>> map;
+    auto value = std::make_shared<int>(0);
+    for (int i = 0; i < 16; ++i)
+        map[i] = value;
+    EXPECT_EQ(value.use_count(), 17);
+
+    for (int i = 0; i < 16; ++i)
+        map.erase(i);
+    EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(FlatHashMapTest, MatchesUnorderedMap)
+{
+    // random mix of inserts and erases on a small key space, so that
+    // erasing has to shift clusters back
+    std::mt19937 rng(1);
+    FlatHashMap<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> ref;
+
+    for (int i = 0; i < 200000; ++i) {
+        uint64_t key = (rng() % 512) << 6;
+        switch (rng() % 3) {
+          case 0:
+            EXPECT_EQ(map.emplace(key, i).second,
+                      ref.emplace(key, i).second);
+            break;
+          case 1:
+            EXPECT_EQ(map.erase(key), ref.erase(key));
+            break;
+          default: {
+            auto it = map.find(key);
+            auto ref_it = ref.find(key);
+            ASSERT_EQ(it == map.end(), ref_it == ref.end());
+            if (ref_it != ref.end()) {
+                EXPECT_EQ(it->second, ref_it->second);
+            }
+          }
+        }
+        ASSERT_EQ(map.size(), ref.size());
+    }
+
+    for (const auto &entry : map)
+        EXPECT_EQ(ref.at(entry.first), entry.second);
+}
+
+TEST(FlatHashMapTest, LongProbeSequencesGrow)
+{
+    // keys that all land in the first slot of a 512 entry table, so
+    // that probe distances overflow before the load factor is reached
+    std::mt19937_64 rng(1);
+    std::vector<uint64_t> keys;
+    while (keys.size() < 300) {
+        uint64_t key = rng();
+        if (((key * 0x9e3779b97f4a7c15ULL) >> 55) == 0)
+            keys.push_back(key);
+    }
+
+    FlatHashMap<uint64_t, uint64_t> map;
+    map.reserve(300);
+    for (uint64_t key : keys)
+        EXPECT_TRUE(map.emplace(key, key + 1).second);
+
+    EXPECT_EQ(map.size(), keys.size());
+    for (uint64_t key : keys) {
+        auto it = map.find(key);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it->second, key + 1);
+    }
+}
@@ -0,0 +1,530 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/indexed_ini.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "base/logging.hh"
+#include "base/str.hh"
+
+using namespace std;
+
+namespace IndexedIni {
+
+namespace {
+
+const char magic[8] = "gem5cpb";
+const uint32_t version = 1;
+const uint32_t byteOrder = 0x01020304;
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t numSections;
+    uint32_t tableSize;
+    uint64_t tableOffset;
+};
+
+/** Hash table slot, an offset of 0 marks an empty one */
+struct Slot
+{
+    uint64_t hash;
+    uint64_t offset;
+};
+
+/**
+ * A section is this, its name and its entry table, sorted by name.
+ * Everything is aligned to 8 bytes.
+ */
+struct SectionRecord
+{
+    uint32_t nameSize;
+    uint32_t numEntries;
+};
+
+uint64_t
+hashName(const char *name, size_t size)
+{
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= (uint8_t)name[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t
+align(uint64_t offset)
+{
+    return (offset + 7) & ~uint64_t(7);
+}
+
+void
+pad(string &buf)
+{
+    buf.resize(align(buf.size()), '\0');
+}
+
+template <class T>
+void
+formatArray(ostream &os, const void *data, size_t count)
+{
+    const T *values = static_cast<const T *>(data);
+    for (size_t i = 0; i < count; ++i) {
+        if (i)
+            os << " ";
+        // Promote chars so that they print as numbers
+        os << +values[i];
+    }
+}
+
+template <>
+void
+formatArray<bool>(ostream &os, const void *data, size_t count)
+{
+    const uint8_t *values = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < count; ++i)
+        os << (i ? " " : "") << (values[i] ? "true" : "false");
+}
+
+} // anonymous namespace
+
+struct EntryRecord
+{
+    uint64_t nameOffset;
+    uint64_t dataOffset;
+    uint32_t nameSize;
+    /** Elements of an array, bytes of a text */
+    uint32_t count;
+    uint32_t type;
+    uint32_t reserved;
+};
+
+size_t
+typeSize(Type type)
+{
+    switch (type) {
+      case Int8:
+      case UInt8:
+      case Bool:
+        return 1;
+      case Int16:
+      case UInt16:
+        return 2;
+      case Int32:
+      case UInt32:
+      case Float:
+        return 4;
+      case Int64:
+      case UInt64:
+      case Double:
+        return 8;
+      default:
+        return 1;
+    }
+}
+
+Writer::Entry &
+Writer::entry(const string &section, const string &entry)
+{
+    auto s = sectionIndex.find(section);
+    if (s == sectionIndex.end()) {
+        s = sectionIndex.emplace(section, sections.size()).first;
+        sections.emplace_back();
+        sections.back().name = section;
+    }
+
+    Section &sec = sections[s->second];
+    auto e = sec.index.find(entry);
+    if (e == sec.index.end()) {
+        e = sec.index.emplace(entry, sec.entries.size()).first;
+        sec.entries.emplace_back();
+        sec.entries.back().name = entry;
+        sec.entries.back().type = Text;
+        sec.entries.back().count = 0;
+    }
+    return sec.entries[e->second];
+}
+
+void
+Writer::add(const string &section, const string &name, const string &value)
+{
+    // The file format holds 32-bit counts
+    fatal_if(value.size() > UINT32_MAX,
+             "%s.%s: %d bytes is too long for an indexed ini file\n",
+             section, name, value.size());
+    Entry &e = entry(section, name);
+    e.type = Text;
+    e.count = value.size();
+    e.data = value;
+}
+
+void
+Writer::addArray(const string &section, const string &name, Type type,
+                 const void *data, size_t count)
+{
+    fatal_if(count > UINT32_MAX,
+             "%s.%s: %d elements are too many for an indexed ini file\n",
+             section, name, count);
+    Entry &e = entry(section, name);
+    e.type = type;
+    e.count = count;
+    e.data.assign(static_cast<const char *>(data), count * typeSize(type));
+}
+
+bool
+Writer::load(istream &is)
+{
+    const string *section = nullptr;
+    string section_name;
+
+    while (!is.eof()) {
+        is >> ws;
+        if (is.eof())
+            break;
+
+        string line;
+        getline(is, line);
+        if (line.empty())
+            continue;
+
+        eat_end_white(line);
+        const size_t last = line.size() - 1;
+        if (line[0] == '[' && line[last] == ']') {
+            section_name = line.substr(1, last - 1);
+            eat_white(section_name);
+            section = &section_name;
+            continue;
+        }
+
+        if (!section)
+            continue;
+
+        const size_t offset = line.find('=');
+        if (offset == string::npos)
+            return false;
+
+        const bool append = offset > 0 && line[offset - 1] == '+';
+        string name = line.substr(0, append ? offset - 1 : offset);
+        string value = line.substr(offset + 1);
+        eat_white(name);
+        eat_white(value);
+
+        Entry &e = entry(*section, name);
+        if (append && e.type == Text && e.count)
+            value = e.data + " " + value;
+        add(*section, name, value);
+    }
+
+    return true;
+}
+
+bool
+Writer::write(const string &filename) const
+{
+    uint32_t table_size = 2;
+    while (table_size < sections.size() * 2)
+        table_size *= 2;
+    vector<Slot> table(table_size, Slot{0, 0});
+
+    string buf(sizeof(FileHeader), '\0');
+    for (const auto &sec : sections) {
+        pad(buf);
+        const uint64_t hash = hashName(sec.name.data(), sec.name.size());
+        uint32_t slot = hash & (table_size - 1);
+        while (table[slot].offset)
+            slot = (slot + 1) & (table_size - 1);
+        table[slot].hash = hash;
+        table[slot].offset = buf.size();
+
+        SectionRecord record{(uint32_t)sec.name.size(),
+                             (uint32_t)sec.entries.size()};
+        buf.append(reinterpret_cast<const char *>(&record), sizeof(record));
+        buf.append(sec.name);
+        pad(buf);
+
+        vector<const Entry *> sorted;
+        for (const auto &e : sec.entries)
+            sorted.push_back(&e);
+        sort(sorted.begin(), sorted.end(),
+             [](const Entry *a, const Entry *b) { return a->name < b->name; });
+
+        const size_t records = buf.size();
+        buf.resize(records + sorted.size() * sizeof(EntryRecord));
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            const Entry &e = *sorted[i];
+            EntryRecord r;
+            r.nameOffset = buf.size();
+            r.nameSize = e.name.size();
+            buf.append(e.name);
+            pad(buf);
+            r.dataOffset = buf.size();
+            r.count = e.count;
+            r.type = e.type;
+            r.reserved = 0;
+            buf.append(e.data);
+            memcpy(&buf[records + i * sizeof(r)], &r, sizeof(r));
+        }
+    }
+
+    pad(buf);
+    FileHeader header;
+    memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = version;
+    header.byteOrder = byteOrder;
+    header.numSections = sections.size();
+    header.tableSize = table_size;
+    header.tableOffset = buf.size();
+    buf.append(reinterpret_cast<const char *>(table.data()),
+               table.size() * sizeof(Slot));
+    memcpy(&buf[0], &header, sizeof(header));
+
+    ofstream os(filename, ios::binary | ios::trunc);
+    os.write(buf.data(), buf.size());
+    os.close();
+    return !os.fail();
+}
+
+File::File()
+    : base(nullptr), size(0)
+{
+}
+
+File::~File()
+{
+    if (base)
+        munmap(const_cast<char *>(base), size);
+}
+
+bool
+File::load(const string &filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    void *map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(FileHeader))
+        map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return false;
+
+    base = static_cast<const char *>(map);
+    size = st.st_size;
+
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(base);
+    const uint32_t table_size = header->tableSize;
+    if (memcmp(header->magic, magic, sizeof(header->magic)) != 0 ||
+        header->version != version || header->byteOrder != byteOrder ||
+        !table_size || (table_size & (table_size - 1)) ||
+        !at(header->tableOffset, uint64_t(table_size) * sizeof(Slot))) {
+        munmap(map, size);
+        base = nullptr;
+        size = 0;
+        return false;
+    }
+
+    return true;
+}
+
+const char *
+File::at(uint64_t offset, uint64_t bytes) const
+{
+    if (offset > size || bytes > size - offset)
+        return nullptr;
+    return base + offset;
+}
+
+const char *
+File::findSection(const string &section, uint32_t &num_entries) const
+{
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(base);
+    const Slot *table =
+        reinterpret_cast<const Slot *>(base + header->tableOffset);
+    const uint32_t mask = header->tableSize - 1;
+    const uint64_t hash = hashName(section.data(), section.size());
+
+    for (uint32_t i = 0; i <= mask; ++i) {
+        const Slot &slot = table[(hash + i) & mask];
+        if (!slot.offset)
+            return nullptr;
+        if (slot.hash != hash)
+            continue;
+
+        const SectionRecord *record = reinterpret_cast<const SectionRecord *>(
+            at(slot.offset, sizeof(SectionRecord)));
+        if (!record)
+            return nullptr;
+        const uint64_t name_offset = slot.offset + sizeof(SectionRecord);
+        const char *name = at(name_offset, record->nameSize);
+        if (!name || record->nameSize != section.size() ||
+            memcmp(name, section.data(), section.size()) != 0) {
+            continue;
+        }
+
+        num_entries = record->numEntries;
+        return at(align(name_offset + record->nameSize),
+                  uint64_t(num_entries) * sizeof(EntryRecord));
+    }
+    return nullptr;
+}
+
+const EntryRecord *
+File::findEntry(const string &section, const string &entry) const
+{
+    if (!base)
+        return nullptr;
+
+    uint32_t num_entries;
+    const EntryRecord *records = reinterpret_cast<const EntryRecord *>(
+        findSection(section, num_entries));
+    if (!records)
+        return nullptr;
+
+    uint32_t lo = 0, hi = num_entries;
+    while (lo < hi) {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        const EntryRecord &r = records[mid];
+        const char *name = at(r.nameOffset, r.nameSize);
+        if (!name)
+            return nullptr;
+
+        int cmp = memcmp(name, entry.data(), min<size_t>(r.nameSize,
+                                                         entry.size()));
+        if (!cmp)
+            cmp = r.nameSize < entry.size() ? -1 : r.nameSize > entry.size();
+        if (!cmp) {
+            const uint64_t bytes = r.type == Text ? r.count :
+                uint64_t(r.count) * typeSize(Type(r.type));
+            return at(r.dataOffset, bytes) ? &r : nullptr;
+        }
+        if (cmp < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return nullptr;
+}
+
+bool
+File::find(const string &section, const string &entry, string &value) const
+{
+    const EntryRecord *r = findEntry(section, entry);
+    if (!r)
+        return false;
+
+    const char *data = base + r->dataOffset;
+    if (r->type == Text) {
+        value.assign(data, r->count);
+        return true;
+    }
+
+    ostringstream os;
+    switch (r->type) {
+      case Int8: formatArray<int8_t>(os, data, r->count); break;
+      case UInt8: formatArray<uint8_t>(os, data, r->count); break;
+      case Int16: formatArray<int16_t>(os, data, r->count); break;
+      case UInt16: formatArray<uint16_t>(os, data, r->count); break;
+      case Int32: formatArray<int32_t>(os, data, r->count); break;
+      case UInt32: formatArray<uint32_t>(os, data, r->count); break;
+      case Int64: formatArray<int64_t>(os, data, r->count); break;
+      case UInt64: formatArray<uint64_t>(os, data, r->count); break;
+      case Bool: formatArray<bool>(os, data, r->count); break;
+      case Float: formatArray<float>(os, data, r->count); break;
+      case Double: formatArray<double>(os, data, r->count); break;
+      default: return false;
+    }
+    value = os.str();
+    return true;
+}
+
+bool
+File::findArray(const string &section, const string &entry, Type &type,
+                const void *&data, size_t &count) const
+{
+    const EntryRecord *r = findEntry(section, entry);
+    if (!r || r->type == Text)
+        return false;
+
+    type = Type(r->type);
+    data = base + r->dataOffset;
+    count = r->count;
+    return true;
+}
+
+bool
+File::entryExists(const string &section, const string &entry) const
+{
+    return findEntry(section, entry) != nullptr;
+}
+
+bool
+File::sectionExists(const string &section) const
+{
+    uint32_t num_entries;
+    return base && findSection(section, num_entries) != nullptr;
+}
+
+void
+File::getSectionNames(vector<string> &list) const
+{
+    if (!base)
+        return;
+
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(base);
+    const Slot *table =
+        reinterpret_cast<const Slot *>(base + header->tableOffset);
+
+    for (uint32_t i = 0; i < header->tableSize; ++i) {
+        if (!table[i].offset)
+            continue;
+        const SectionRecord *record = reinterpret_cast<const SectionRecord *>(
+            at(table[i].offset, sizeof(SectionRecord)));
+        const char *name = record ?
+            at(table[i].offset + sizeof(SectionRecord), record->nameSize) :
+            nullptr;
+        if (name)
+            list.emplace_back(name, record->nameSize);
+    }
+}
+
+} // namespace IndexedIni
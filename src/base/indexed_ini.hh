@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_INDEXED_INI_HH__
+#define __BASE_INDEXED_INI_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file
+ * Binary counterpart of IniFile for large files that are read much
+ * more than they are written, like checkpoints. Sections are found
+ * through a hash table of their names, and entries by a binary search
+ * of the sorted entry table of their section, right in the mapped
+ * file. Opening a file thus costs the same whatever its size, and a
+ * section is only ever looked at when it is asked for.
+ *
+ * Besides the text values of an ini file, entries can hold arrays of
+ * numbers in their binary form, which are handed back as is.
+ */
+
+namespace IndexedIni {
+
+/** Type of the value of an entry */
+enum Type : uint32_t
+{
+    Text,
+    Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64,
+    Bool, Float, Double,
+};
+
+/** Type of an array of T, for integral and floating point T */
+template <class T>
+constexpr Type
+arrayType()
+{
+    return std::is_same<T, bool>::value ? Bool :
+        std::is_floating_point<T>::value ?
+            (sizeof(T) == sizeof(float) ? Float : Double) :
+        sizeof(T) == 1 ? (std::is_signed<T>::value ? Int8 : UInt8) :
+        sizeof(T) == 2 ? (std::is_signed<T>::value ? Int16 : UInt16) :
+        sizeof(T) == 4 ? (std::is_signed<T>::value ? Int32 : UInt32) :
+        (std::is_signed<T>::value ? Int64 : UInt64);
+}
+
+/** Size of an element of an array of the given type */
+size_t typeSize(Type type);
+
+/** Entry table record of the file format */
+struct EntryRecord;
+
+/**
+ * Builds an indexed ini file in memory and writes it out.
+ */
+class Writer
+{
+  public:
+    /** Set an entry to a text value */
+    void add(const std::string &section, const std::string &entry,
+             const std::string &value);
+
+    /** Set an entry to an array of count elements of the given type */
+    void addArray(const std::string &section, const std::string &entry,
+                  Type type, const void *data, size_t count);
+
+    /**
+     * Add the contents of a text ini file, as IniFile::load() reads
+     * it. Returns false on a parse error.
+     */
+    bool load(std::istream &is);
+
+    /** Write the file, false if it couldn't be written */
+    bool write(const std::string &filename) const;
+
+  private:
+    struct Entry
+    {
+        std::string name;
+        Type type;
+        uint32_t count;
+        std::string data;
+    };
+
+    struct Section
+    {
+        std::string name;
+        std::vector<Entry> entries;
+        std::unordered_map<std::string, size_t> index;
+    };
+
+    Entry &entry(const std::string &section, const std::string &entry);
+
+    std::vector<Section> sections;
+    std::unordered_map<std::string, size_t> sectionIndex;
+};
+
+/**
+ * Read-only view of an indexed ini file.
+ */
+class File
+{
+  public:
+    File();
+    ~File();
+
+    File(const File &) = delete;
+    File &operator=(const File &) = delete;
+
+    /** Map a file, false if it can't be read or isn't an indexed ini */
+    bool load(const std::string &filename);
+
+    /**
+     * Find the value of an entry. Arrays are formatted as the space
+     * separated list an ini file would hold.
+     */
+    bool find(const std::string &section, const std::string &entry,
+              std::string &value) const;
+
+    /**
+     * Find an array entry. The data points into the mapped file and
+     * is aligned for its type. Returns false for text entries.
+     */
+    bool findArray(const std::string &section, const std::string &entry,
+                   Type &type, const void *&data, size_t &count) const;
+
+    bool entryExists(const std::string &section,
+                     const std::string &entry) const;
+    bool sectionExists(const std::string &section) const;
+
+    /** Append the names of all the sections, in no particular order */
+    void getSectionNames(std::vector<std::string> &list) const;
+
+  private:
+    const char *base;
+    size_t size;
+
+    const char *at(uint64_t offset, uint64_t bytes) const;
+    const char *findSection(const std::string &section,
+                            uint32_t &num_entries) const;
+    const EntryRecord *findEntry(const std::string &section,
+                                 const std::string &entry) const;
+};
+
+} // namespace IndexedIni
+
+#endif // __BASE_INDEXED_INI_HH__
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/indexed_ini.hh"
+
+using namespace IndexedIni;
+
+namespace {
+
+/** A temporary file that is removed when going out of scope */
+struct TempFile
+{
+    std::string name;
+
+    TempFile()
+    {
+        char path[] = "/tmp/indexed_ini_test.XXXXXX";
+        int fd = mkstemp(path);
+        EXPECT_GE(fd, 0);
+        close(fd);
+        name = path;
+    }
+
+    ~TempFile() { unlink(name.c_str()); }
+};
+
+} // anonymous namespace
+
+TEST(IndexedIniTest, TextEntries)
+{
+    TempFile tmp;
+    Writer writer;
+    writer.add("system.cpu", "pc", "0x400000");
+    writer.add("system.cpu", "name", "");
+    writer.add("system", "curTick", "1000");
+    writer.add("system", "curTick", "2000");
+    writer.add("empty", "", "x");
+    ASSERT_TRUE(writer.write(tmp.name));
+
+    File file;
+    ASSERT_TRUE(file.load(tmp.name));
+
+    std::string value;
+    EXPECT_TRUE(file.find("system.cpu", "pc", value));
+    EXPECT_EQ(value, "0x400000");
+    EXPECT_TRUE(file.find("system.cpu", "name", value));
+    EXPECT_EQ(value, "");
+    // later values override earlier ones
+    EXPECT_TRUE(file.find("system", "curTick", value));
+    EXPECT_EQ(value, "2000");
+
+    EXPECT_FALSE(file.find("system", "pc", value));
+    EXPECT_FALSE(file.find("system.cpu0", "pc", value));
+    EXPECT_TRUE(file.sectionExists("empty"));
+    EXPECT_TRUE(file.entryExists("empty", ""));
+    EXPECT_FALSE(file.sectionExists("system.cp"));
+    EXPECT_TRUE(file.entryExists("system.cpu", "pc"));
+    EXPECT_FALSE(file.entryExists("system.cpu", "p"));
+}
+
+TEST(IndexedIniTest, Arrays)
+{
+    TempFile tmp;
+    Writer writer;
+    const std::vector<uint64_t> regs = { 0, 1, 0xffffffffffffffffULL };
+    const std::vector<int8_t> bytes = { -1, 2, 'a' };
+    const uint8_t flags[] = { 1, 0 };
+    const std::vector<double> values = { 0.5, -2.25 };
+    writer.addArray("cpu", "regs", arrayType<uint64_t>(), regs.data(),
+                    regs.size());
+    writer.addArray("cpu", "bytes", arrayType<int8_t>(), bytes.data(),
+                    bytes.size());
+    writer.addArray("cpu", "flags", arrayType<bool>(), flags, 2);
+    writer.addArray("cpu", "values", arrayType<double>(), values.data(),
+                    values.size());
+    writer.addArray("cpu", "none", arrayType<int>(), nullptr, 0);
+    ASSERT_TRUE(writer.write(tmp.name));
+
+    File file;
+    ASSERT_TRUE(file.load(tmp.name));
+
+    Type type;
+    const void *data;
+    size_t count;
+    ASSERT_TRUE(file.findArray("cpu", "regs", type, data, count));
+    EXPECT_EQ(type, UInt64);
+    ASSERT_EQ(count, regs.size());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % sizeof(uint64_t), 0);
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ(static_cast<const uint64_t *>(data)[i], regs[i]);
+
+    ASSERT_TRUE(file.findArray("cpu", "none", type, data, count));
+    EXPECT_EQ(type, Int32);
+    EXPECT_EQ(count, 0);
+
+    // arrays read as text look like they do in an ini file
+    std::string value;
+    EXPECT_TRUE(file.find("cpu", "regs", value));
+    EXPECT_EQ(value, "0 1 18446744073709551615");
+    EXPECT_TRUE(file.find("cpu", "bytes", value));
+    EXPECT_EQ(value, "-1 2 97");
+    EXPECT_TRUE(file.find("cpu", "flags", value));
+    EXPECT_EQ(value, "true false");
+    EXPECT_TRUE(file.find("cpu", "values", value));
+    EXPECT_EQ(value, "0.5 -2.25");
+    EXPECT_TRUE(file.find("cpu", "none", value));
+    EXPECT_EQ(value, "");
+}
+
+TEST(IndexedIniTest, LoadIni)
+{
+    TempFile tmp;
+    std::istringstream ini(
+        "## comment lines are outside of any section\n"
+        "ignored=1\n"
+        "\n"
+        "[Globals]\n"
+        "curTick=42\n"
+        "[ system.mem ]  \n"
+        "  range = 0:1024  \n"
+        "list=a b\n"
+        "list+=c\n");
+
+    Writer writer;
+    ASSERT_TRUE(writer.load(ini));
+    ASSERT_TRUE(writer.write(tmp.name));
+
+    File file;
+    ASSERT_TRUE(file.load(tmp.name));
+
+    std::string value;
+    EXPECT_TRUE(file.find("Globals", "curTick", value));
+    EXPECT_EQ(value, "42");
+    EXPECT_TRUE(file.find("system.mem", "range", value));
+    EXPECT_EQ(value, "0:1024");
+    EXPECT_TRUE(file.find("system.mem", "list", value));
+    EXPECT_EQ(value, "a b c");
+    EXPECT_FALSE(file.entryExists("", "ignored"));
+
+    std::istringstream bad("[section]\nno assignment\n");
+    EXPECT_FALSE(writer.load(bad));
+}
+
+TEST(IndexedIniTest, ManySections)
+{
+    TempFile tmp;
+    Writer writer;
+    for (int i = 0; i < 5000; ++i) {
+        std::string section = "system.ruby.l1_cntrl" + std::to_string(i);
+        for (int j = 0; j < 10; ++j) {
+            writer.add(section, "entry" + std::to_string(j),
+                       std::to_string(i * 10 + j));
+        }
+    }
+    ASSERT_TRUE(writer.write(tmp.name));
+
+    File file;
+    ASSERT_TRUE(file.load(tmp.name));
+    for (int i = 0; i < 5000; ++i) {
+        std::string section = "system.ruby.l1_cntrl" + std::to_string(i);
+        for (int j = 0; j < 10; ++j) {
+            std::string value;
+            ASSERT_TRUE(file.find(section, "entry" + std::to_string(j),
+                                  value));
+            EXPECT_EQ(value, std::to_string(i * 10 + j));
+        }
+        EXPECT_FALSE(file.entryExists(section, "entry10"));
+    }
+    EXPECT_FALSE(file.sectionExists("system.ruby.l1_cntrl5000"));
+
+    std::vector<std::string> names;
+    file.getSectionNames(names);
+    ASSERT_EQ(names.size(), 5000u);
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(std::unique(names.begin(), names.end()), names.end());
+    EXPECT_EQ(names.front(), "system.ruby.l1_cntrl0");
+}
+
+TEST(IndexedIniTest, RejectInvalid)
+{
+    TempFile tmp;
+    File file;
+    {
+        std::ofstream os(tmp.name);
+        os << "[Globals]\ncurTick=0\n";
+    }
+    EXPECT_FALSE(file.load(tmp.name));
+    EXPECT_FALSE(file.load(tmp.name + ".missing"));
+
+    std::string value;
+    EXPECT_FALSE(file.find("Globals", "curTick", value));
+    EXPECT_FALSE(file.sectionExists("Globals"));
+}
@@ -46,6 +46,7 @@
 #include <sstream>
 
 #include "base/hostinfo.hh"
+#include "base/trace.hh"
 
 namespace {
 
@@ -70,6 +71,8 @@ class ExitLogger : public NormalLogger
         std::stringstream ss;
         ccprintf(ss, "Memory Usage: %ld KBytes\n", memUsage());
         NormalLogger::log(loc, s + ss.str());
+        // Save the debug messages leading up to the failure
+        Trace::crashDump();
     }
 };
 
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_POOL_ALLOCATOR_HH__
+#define __BASE_POOL_ALLOCATOR_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+/**
+ * Per-thread free list of memory blocks of a fixed size.
+ *
+ * Every block belongs to the pool of the thread that took it from the
+ * heap. Blocks released by that thread go straight back onto its free
+ * list. Blocks released by another thread, e.g. a packet that crossed
+ * a ThreadBridge, are pushed onto a lock-free list of the owning pool
+ * and picked up by its thread once its own free list runs out, so a
+ * pool never grows with blocks that other threads allocated. Memory
+ * is only taken from the heap while a pool grows and is never
+ * returned to it. Since each event queue is serviced by its own
+ * thread, every event queue effectively has its own pool.
+ *
+ * @tparam Size Size of the blocks in bytes.
+ */
+template <size_t Size>
+class BlockPool
+{
+  private:
+    /** Overlays the storage of a released block. */
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    /** The pool of one thread. */
+    struct ThreadPool
+    {
+        FreeBlock *freeList = nullptr;
+        /** Blocks of this pool released by other threads. */
+        std::atomic<FreeBlock *> remoteList{nullptr};
+    };
+
+    /** Precedes every block, padded to keep the block aligned. */
+    union Header
+    {
+        ThreadPool *owner;
+        std::max_align_t align;
+    };
+
+    /**
+     * Pool of the calling thread. Pools are never deleted since other
+     * threads may still release blocks into them.
+     */
+    static ThreadPool *
+    localPool()
+    {
+        if (!local)
+            local = new ThreadPool;
+        return local;
+    }
+
+    static Header *
+    header(void *p)
+    {
+        return static_cast<Header *>(p) - 1;
+    }
+
+    static __thread ThreadPool *local;
+
+  public:
+    static const size_t blockSize =
+        Size < sizeof(FreeBlock) ? sizeof(FreeBlock) : Size;
+
+    /** True if the next allocate() on this thread reuses a block. */
+    static bool
+    hasFree()
+    {
+        return local && (local->freeList ||
+                         local->remoteList.load(std::memory_order_relaxed));
+    }
+
+    static void *
+    allocate()
+    {
+        ThreadPool *pool = localPool();
+        FreeBlock *block = pool->freeList;
+        if (!block) {
+            block = pool->remoteList.exchange(nullptr,
+                                              std::memory_order_acquire);
+        }
+
+        if (!block) {
+            Header *h = static_cast<Header *>(
+                ::operator new(sizeof(Header) + blockSize));
+            h->owner = pool;
+            return h + 1;
+        }
+
+        pool->freeList = block->next;
+        return block;
+    }
+
+    static void
+    release(void *p)
+    {
+        ThreadPool *pool = header(p)->owner;
+        FreeBlock *block = static_cast<FreeBlock *>(p);
+
+        if (pool == local) {
+            block->next = pool->freeList;
+            pool->freeList = block;
+            return;
+        }
+
+        // Only the owner ever takes the list, and it takes all of it,
+        // so a plain push is safe.
+        block->next = pool->remoteList.load(std::memory_order_relaxed);
+        while (!pool->remoteList.compare_exchange_weak(
+                   block->next, block, std::memory_order_release,
+                   std::memory_order_relaxed)) {
+        }
+    }
+};
+
+template <size_t Size>
+__thread typename BlockPool<Size>::ThreadPool *BlockPool<Size>::local =
+    nullptr;
+
+/**
+ * Standard allocator that takes single objects from a BlockPool, e.g.
+ * for std::allocate_shared. Arrays use the global heap.
+ */
+template <class T>
+class PoolAllocator
+{
+  public:
+    typedef T value_type;
+
+    PoolAllocator() {}
+
+    template <class U>
+    PoolAllocator(const PoolAllocator<U> &) {}
+
+    T *
+    allocate(size_t n)
+    {
+        if (n == 1)
+            return static_cast<T *>(BlockPool<sizeof(T)>::allocate());
+        else
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *p, size_t n)
+    {
+        if (n == 1)
+            BlockPool<sizeof(T)>::release(p);
+        else
+            ::operator delete(p);
+    }
+};
+
+template <class T, class U>
+bool
+operator==(const PoolAllocator<T> &, const PoolAllocator<U> &)
+{
+    return true;
+}
+
+template <class T, class U>
+bool
+operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &)
+{
+    return false;
+}
+
+#endif // __BASE_POOL_ALLOCATOR_HH__
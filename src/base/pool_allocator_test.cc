@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+#include "base/pool_allocator.hh"
+
+TEST(PoolAllocatorTest, ReusesReleasedBlocks)
+{
+    void *a = BlockPool<48>::allocate();
+    void *b = BlockPool<48>::allocate();
+    EXPECT_NE(a, b);
+
+    BlockPool<48>::release(a);
+    BlockPool<48>::release(b);
+    EXPECT_TRUE(BlockPool<48>::hasFree());
+
+    // Blocks are handed out again in LIFO order.
+    EXPECT_EQ(BlockPool<48>::allocate(), b);
+    EXPECT_EQ(BlockPool<48>::allocate(), a);
+    EXPECT_FALSE(BlockPool<48>::hasFree());
+
+    BlockPool<48>::release(a);
+    BlockPool<48>::release(b);
+}
+
+TEST(PoolAllocatorTest, FreeListsArePerThread)
+{
+    void *block = BlockPool<24>::allocate();
+    std::thread other([] {
+        EXPECT_FALSE(BlockPool<24>::hasFree());
+        BlockPool<24>::release(BlockPool<24>::allocate());
+        EXPECT_TRUE(BlockPool<24>::hasFree());
+    });
+    other.join();
+
+    EXPECT_FALSE(BlockPool<24>::hasFree());
+    BlockPool<24>::release(block);
+    EXPECT_TRUE(BlockPool<24>::hasFree());
+}
+
+TEST(PoolAllocatorTest, BlocksReturnToAllocatingThread)
+{
+    void *block = BlockPool<40>::allocate();
+    std::thread other([block] {
+        BlockPool<40>::release(block);
+        EXPECT_FALSE(BlockPool<40>::hasFree());
+    });
+    other.join();
+
+    // The block went back to this thread's pool, not the other's.
+    EXPECT_TRUE(BlockPool<40>::hasFree());
+    EXPECT_EQ(BlockPool<40>::allocate(), block);
+    EXPECT_FALSE(BlockPool<40>::hasFree());
+    BlockPool<40>::release(block);
+}
+
+namespace
+{
+
+struct Tracked
+{
+    static int live;
+    int value;
+
+    Tracked(int v) : value(v) { live++; }
+    ~Tracked() { live--; }
+};
+
+int Tracked::live = 0;
+
+} // anonymous namespace
+
+TEST(PoolAllocatorTest, AllocateShared)
+{
+    PoolAllocator<Tracked> alloc;
+    const void *first;
+    {
+        auto p = std::allocate_shared<Tracked>(alloc, 42);
+        EXPECT_EQ(p->value, 42);
+        EXPECT_EQ(Tracked::live, 1);
+        first = p.get();
+    }
+    EXPECT_EQ(Tracked::live, 0);
+
+    // The combined control block and object is recycled.
+    auto q = std::allocate_shared<Tracked>(alloc, 7);
+    EXPECT_EQ(q.get(), first);
+    EXPECT_EQ(q->value, 7);
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_SPSC_QUEUE_HH__
+#define __BASE_SPSC_QUEUE_HH__
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+
+/**
+ * Unbounded lock-free single-producer single-consumer FIFO.
+ *
+ * Elements are stored in fixed-size blocks that form a linked
+ * list. The producer appends to the tail block and links in a new
+ * block when it fills up; the consumer pops from the head block and
+ * frees it once it has been consumed. The only shared state is the
+ * number of elements pushed so far, which the producer publishes with
+ * release semantics after writing an element, and the number of
+ * elements popped, which the consumer publishes likewise. One thread
+ * may call push() while another thread calls front()/pop()
+ * concurrently; any other concurrent use needs external
+ * synchronisation.
+ *
+ * @tparam T Element type, must be default constructible and copyable.
+ * @tparam BlockSize Number of elements per block.
+ */
+template <typename T, size_t BlockSize = 256>
+class SPSCQueue
+{
+  private:
+    struct Block
+    {
+        T items[BlockSize];
+        Block *next;
+
+        Block() : next(nullptr) {}
+    };
+
+    /** Block and index the consumer pops from. */
+    Block *headBlock;
+    size_t headIdx;
+
+    /** Block and index the producer pushes to. */
+    Block *tailBlock;
+    size_t tailIdx;
+
+    /** Total number of elements pushed, written by the producer. */
+    std::atomic<size_t> pushed;
+
+    /** Total number of elements popped, written by the consumer. */
+    std::atomic<size_t> popped;
+
+  public:
+    SPSCQueue()
+        : headBlock(new Block), headIdx(0), tailBlock(headBlock),
+          tailIdx(0), pushed(0), popped(0)
+    {}
+
+    ~SPSCQueue()
+    {
+        while (headBlock) {
+            Block *next = headBlock->next;
+            delete headBlock;
+            headBlock = next;
+        }
+    }
+
+    SPSCQueue(const SPSCQueue &) = delete;
+    SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+    /** Append an element. Producer only. */
+    void
+    push(const T &item)
+    {
+        if (tailIdx == BlockSize) {
+            // The consumer never touches a block's next pointer before
+            // the first element of the next block has been published.
+            tailBlock->next = new Block;
+            tailBlock = tailBlock->next;
+            tailIdx = 0;
+        }
+
+        tailBlock->items[tailIdx++] = item;
+        pushed.store(pushed.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_release);
+    }
+
+    /**
+     * Oldest element, or nullptr if the queue is empty. Consumer
+     * only. The pointer stays valid until the next call to pop().
+     */
+    T *
+    front()
+    {
+        if (popped.load(std::memory_order_relaxed) ==
+            pushed.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        if (headIdx == BlockSize) {
+            Block *next = headBlock->next;
+            assert(next);
+            delete headBlock;
+            headBlock = next;
+            headIdx = 0;
+        }
+
+        return &headBlock->items[headIdx];
+    }
+
+    /** Remove the oldest element. Consumer only. */
+    void
+    pop()
+    {
+        T *item = front();
+        assert(item);
+        *item = T();
+        headIdx++;
+        popped.store(popped.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_release);
+    }
+
+    /**
+     * Number of elements in the queue. Exact when called by the
+     * producer or the consumer while the other side is idle, and a
+     * snapshot otherwise.
+     */
+    size_t
+    size() const
+    {
+        return pushed.load(std::memory_order_acquire) -
+            popped.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+};
+
+#endif // __BASE_SPSC_QUEUE_HH__
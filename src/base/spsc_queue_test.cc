@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "base/spsc_queue.hh"
+
+TEST(SPSCQueueTest, FifoOrderAcrossBlocks)
+{
+    SPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.front(), nullptr);
+
+    for (int i = 0; i < 10; i++)
+        queue.push(i);
+    EXPECT_EQ(queue.size(), 10);
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_NE(queue.front(), nullptr);
+        EXPECT_EQ(*queue.front(), i);
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.front(), nullptr);
+}
+
+TEST(SPSCQueueTest, InterleavedPushPop)
+{
+    SPSCQueue<int, 2> queue;
+    int next_pop = 0;
+    for (int i = 0; i < 100; i++) {
+        queue.push(i);
+        if (i % 3 == 0) {
+            EXPECT_EQ(*queue.front(), next_pop++);
+            queue.pop();
+        }
+    }
+    EXPECT_EQ(queue.size(), 100 - next_pop);
+    while (!queue.empty()) {
+        EXPECT_EQ(*queue.front(), next_pop++);
+        queue.pop();
+    }
+    EXPECT_EQ(next_pop, 100);
+}
+
+TEST(SPSCQueueTest, ConcurrentProducerConsumer)
+{
+    const int count = 1000000;
+    SPSCQueue<int, 64> queue;
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < count; i++)
+            queue.push(i);
+    });
+
+    int expected = 0;
+    bool in_order = true;
+    while (expected < count) {
+        int *item = queue.front();
+        if (!item)
+            continue;
+        in_order = in_order && *item == expected;
+        expected++;
+        queue.pop();
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(queue.empty());
+}
@@ -51,6 +51,8 @@ namespace Stats {
 
 std::string Info::separatorString = "::";
 
+Epoch curEpoch = 1;
+
 // We wrap these in a function to make sure they're built in time.
 list<Info *> &
 statsList()
@@ -377,10 +379,12 @@ HistStor::add(HistStor *hs)
 }
 
 Formula::Formula()
+    : cachedTotal(0.0), cached(0)
 {
 }
 
 Formula::Formula(Temp r)
+    : cachedTotal(0.0), cached(0)
 {
     root = r.getNodePtr();
     setInit();
@@ -392,6 +396,7 @@ Formula::operator=(Temp r)
 {
     assert(!root && "Can't change formulas");
     root = r.getNodePtr();
+    cached = 0;
     setInit();
     assert(size());
     return *this;
@@ -406,6 +411,7 @@ Formula::operator+=(Temp r)
         root = r.getNodePtr();
         setInit();
     }
+    cached = 0;
 
     assert(size());
     return *this;
@@ -416,22 +422,40 @@ Formula::operator/=(Temp r)
 {
     assert (root);
     root = NodePtr(new BinaryNode<std::divides<Result> >(root, r));
+    cached = 0;
 
     assert(size());
     return *this;
 }
 
+void
+Formula::update() const
+{
+    if (root->written() < cached)
+        return;
+
+    cachedResult = root->result();
+    cachedTotal = root->total();
+    cached = newEpoch();
+}
+
 void
 Formula::result(VResult &vec) const
 {
-    if (root)
-        vec = root->result();
+    if (root) {
+        update();
+        vec = cachedResult;
+    }
 }
 
 Result
 Formula::total() const
 {
-    return root ? root->total() : 0.0;
+    if (!root)
+        return 0.0;
+
+    update();
+    return cachedTotal;
 }
 
 size_type
@@ -443,6 +467,12 @@ Formula::size() const
         return root->size();
 }
 
+Epoch
+Formula::written() const
+{
+    return root ? root->written() : 0;
+}
+
 void
 Formula::reset()
 {
@@ -451,10 +481,12 @@ Formula::reset()
 bool
 Formula::zero() const
 {
-    VResult vec;
-    result(vec);
-    for (VResult::size_type i = 0; i < vec.size(); ++i)
-        if (vec[i] != 0.0)
+    if (!root)
+        return true;
+
+    update();
+    for (VResult::size_type i = 0; i < cachedResult.size(); ++i)
+        if (cachedResult[i] != 0.0)
             return false;
     return true;
 }
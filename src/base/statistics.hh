@@ -85,13 +85,36 @@ class InfoProxy : public Base
 {
   protected:
     Stat &s;
+    /** Epochs of the last prepare and reset */
+    Epoch prepared;
+    Epoch resetted;
 
   public:
-    InfoProxy(Stat &stat) : s(stat) {}
+    InfoProxy(Stat &stat) : s(stat), prepared(0), resetted(0) {}
 
     bool check() const { return s.check(); }
-    void prepare() { s.prepare(); }
-    void reset() { s.reset(); }
+
+    void
+    prepare()
+    {
+        // Nothing to copy out if the stat did not change since
+        if (s.written() < prepared)
+            return;
+        s.prepare();
+        prepared = newEpoch();
+    }
+
+    void
+    reset()
+    {
+        // Still in its reset state if it was not written since
+        if (s.written() < resetted)
+            return;
+        s.reset();
+        resetted = newEpoch();
+    }
+
+    Epoch written() const { return s.written(); }
     void
     visit(Output &visitor)
     {
@@ -117,9 +140,13 @@ class VectorInfoProxy : public InfoProxy<Stat, VectorInfo>
   protected:
     mutable VCounter cvec;
     mutable VResult rvec;
+    /** Epoch rvec was filled in */
+    mutable Epoch rvecEpoch;
 
   public:
-    VectorInfoProxy(Stat &stat) : InfoProxy<Stat, VectorInfo>(stat) {}
+    VectorInfoProxy(Stat &stat)
+        : InfoProxy<Stat, VectorInfo>(stat), rvecEpoch(0)
+    {}
 
     size_type size() const { return this->s.size(); }
 
@@ -133,7 +160,10 @@ class VectorInfoProxy : public InfoProxy<Stat, VectorInfo>
     const VResult &
     result() const
     {
-        this->s.result(rvec);
+        if (this->s.written() >= rvecEpoch) {
+            this->s.result(rvec);
+            rvecEpoch = newEpoch();
+        }
         return rvec;
     }
 
@@ -173,6 +203,12 @@ struct StorageParams
 class InfoAccess
 {
   protected:
+    /** Epoch of the last write to this stat */
+    Epoch _written;
+
+  protected:
+    InfoAccess() : _written(0) {}
+
     /** Set up an info class for this statistic */
     void setInfo(Info *info);
     /** Save Storage class parameters if any */
@@ -186,6 +222,14 @@ class InfoAccess
     const Info *info() const;
 
   public:
+    /** Record a change to the value of this stat */
+    void touch() { _written = curEpoch; }
+
+    /**
+     * @return The epoch of the last change to the value of this stat.
+     */
+    Epoch written() const { return _written; }
+
     /**
      * Reset the stat to the default state.
      */
@@ -411,6 +455,7 @@ class DataWrapVec : public DataWrap<Derived, InfoProxyType>
         size_t size = self.size();
         for (off_type i = 0; i < size; ++i)
             self.data(i)->reset(info);
+        this->touch();
     }
 };
 
@@ -474,6 +519,9 @@ class StatStor
   public:
     struct Params : public StorageParams {};
 
+    /** The result only changes on writes. */
+    static const bool timed = false;
+
   public:
     /**
      * Builds this storage element and calls the base constructor of the
@@ -545,6 +593,9 @@ class AvgStor
   public:
     struct Params : public StorageParams {};
 
+    /** The average changes with time, even without writes. */
+    static const bool timed = true;
+
   public:
     /**
      * Build and initializes this stat storage.
@@ -688,12 +739,12 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * Increment the stat by 1. This calls the associated storage object inc
      * function.
      */
-    void operator++() { data()->inc(1); }
+    void operator++() { this->touch(); data()->inc(1); }
     /**
      * Decrement the stat by 1. This calls the associated storage object dec
      * function.
      */
-    void operator--() { data()->dec(1); }
+    void operator--() { this->touch(); data()->dec(1); }
 
     /** Increment the stat by 1. */
     void operator++(int) { ++*this; }
@@ -706,7 +757,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The new value.
      */
     template <typename U>
-    void operator=(const U &v) { data()->set(v); }
+    void operator=(const U &v) { this->touch(); data()->set(v); }
 
     /**
      * Increment the stat by the given value. This calls the associated
@@ -714,7 +765,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The value to add.
      */
     template <typename U>
-    void operator+=(const U &v) { data()->inc(v); }
+    void operator+=(const U &v) { this->touch(); data()->inc(v); }
 
     /**
      * Decrement the stat by the given value. This calls the associated
@@ -722,7 +773,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
      * @param v The value to substract.
      */
     template <typename U>
-    void operator-=(const U &v) { data()->dec(v); }
+    void operator-=(const U &v) { this->touch(); data()->dec(v); }
 
     /**
      * Return the number of elements, always 1 for a scalar.
@@ -738,8 +789,14 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
 
     bool zero() { return result() == 0.0; }
 
-    void reset() { data()->reset(this->info()); }
+    void reset() { this->touch(); data()->reset(this->info()); }
     void prepare() { data()->prepare(this->info()); }
+
+    Epoch
+    written() const
+    {
+        return Storage::timed ? curEpoch : this->_written;
+    }
 };
 
 class ProxyInfo : public ScalarInfo
@@ -854,6 +911,8 @@ class ValueBase : public DataWrap<Derived, ScalarInfoProxy>
     bool check() const { return proxy != NULL; }
     void prepare() { }
     void reset() { }
+    /** Values are read from elsewhere, they may always have changed */
+    Epoch written() const { return curEpoch; }
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -926,12 +985,12 @@ class ScalarProxy
      * Increment the stat by 1. This calls the associated storage object inc
      * function.
      */
-    void operator++() { stat.data(index)->inc(1); }
+    void operator++() { stat.touch(); stat.data(index)->inc(1); }
     /**
      * Decrement the stat by 1. This calls the associated storage object dec
      * function.
      */
-    void operator--() { stat.data(index)->dec(1); }
+    void operator--() { stat.touch(); stat.data(index)->dec(1); }
 
     /** Increment the stat by 1. */
     void operator++(int) { ++*this; }
@@ -947,6 +1006,7 @@ class ScalarProxy
     void
     operator=(const U &v)
     {
+        stat.touch();
         stat.data(index)->set(v);
     }
 
@@ -959,6 +1019,7 @@ class ScalarProxy
     void
     operator+=(const U &v)
     {
+        stat.touch();
         stat.data(index)->inc(v);
     }
 
@@ -971,6 +1032,7 @@ class ScalarProxy
     void
     operator-=(const U &v)
     {
+        stat.touch();
         stat.data(index)->dec(v);
     }
 
@@ -980,6 +1042,9 @@ class ScalarProxy
      */
     size_type size() const { return 1; }
 
+    /** @return The epoch of the last write to the parent stat. */
+    Epoch written() const { return stat.written(); }
+
   public:
     std::string
     str() const
@@ -1094,6 +1159,12 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
         return storage != NULL;
     }
 
+    Epoch
+    written() const
+    {
+        return Storage::timed ? curEpoch : this->_written;
+    }
+
   public:
     VectorBase()
         : storage(nullptr), _size(0)
@@ -1339,6 +1410,7 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
         size_type size = this->size();
         for (off_type i = 0; i < size; ++i)
             data(i)->reset(info);
+        this->touch();
     }
 
     bool
@@ -1346,6 +1418,12 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
     {
         return storage != NULL;
     }
+
+    Epoch
+    written() const
+    {
+        return Storage::timed ? curEpoch : this->_written;
+    }
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -1382,6 +1460,9 @@ class DistStor
                    buckets(0) {}
     };
 
+    /** The result only changes on writes. */
+    static const bool timed = false;
+
   private:
     /** The minimum value to track. */
     Counter min_track;
@@ -1526,6 +1607,9 @@ class HistStor
         Params() : DistParams(Hist), buckets(0) {}
     };
 
+    /** The result only changes on writes. */
+    static const bool timed = false;
+
   private:
     /** The minimum value to track. */
     Counter min_bucket;
@@ -1669,6 +1753,9 @@ class SampleStor
         Params() : DistParams(Deviation) {}
     };
 
+    /** The result only changes on writes. */
+    static const bool timed = false;
+
   private:
     /** The current sum. */
     Counter sum;
@@ -1749,6 +1836,9 @@ class AvgSampleStor
         Params() : DistParams(Deviation) {}
     };
 
+    /** Samples are divided by the simulated time. */
+    static const bool timed = true;
+
   private:
     /** Current total. */
     Counter sum;
@@ -1866,7 +1956,12 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void
+    sample(const U &v, int n = 1)
+    {
+        this->touch();
+        data()->sample(v, n);
+    }
 
     /**
      * Return the number of entries in this stat.
@@ -1892,13 +1987,25 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     void
     reset()
     {
+        this->touch();
         data()->reset(this->info());
     }
 
     /**
      *  Add the argument distribution to the this distribution.
      */
-    void add(DistBase &d) { data()->add(d.data()); }
+    void
+    add(DistBase &d)
+    {
+        this->touch();
+        data()->add(d.data());
+    }
+
+    Epoch
+    written() const
+    {
+        return Storage::timed ? curEpoch : this->_written;
+    }
 
 };
 
@@ -2001,6 +2108,12 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
     {
         return storage != NULL;
     }
+
+    Epoch
+    written() const
+    {
+        return Storage::timed ? curEpoch : this->_written;
+    }
 };
 
 template <class Stat>
@@ -2036,6 +2149,7 @@ class DistProxy
     void
     sample(const U &v, int n = 1)
     {
+        stat.touch();
         data()->sample(v, n);
     }
 
@@ -2086,6 +2200,12 @@ class Node
      */
     virtual Result total() const = 0;
 
+    /**
+     * Return the epoch of the last write to the stats in this subtree.
+     * @return The epoch of the last write.
+     */
+    virtual Epoch written() const = 0;
+
     /**
      *
      */
@@ -2115,6 +2235,8 @@ class ScalarStatNode : public Node
 
     size_type size() const { return 1; }
 
+    Epoch written() const { return data->written(); }
+
     /**
      *
      */
@@ -2152,6 +2274,8 @@ class ScalarProxyNode : public Node
         return 1;
     }
 
+    Epoch written() const { return proxy.written(); }
+
     /**
      *
      */
@@ -2173,6 +2297,7 @@ class VectorStatNode : public Node
     Result total() const { return data->total(); };
 
     size_type size() const { return data->size(); }
+    Epoch written() const { return data->written(); }
 
     std::string str() const { return data->name; }
 };
@@ -2188,6 +2313,7 @@ class ConstNode : public Node
     const VResult &result() const { return vresult; }
     Result total() const { return vresult[0]; };
     size_type size() const { return 1; }
+    Epoch written() const { return 0; }
     std::string str() const { return std::to_string(vresult[0]); }
 };
 
@@ -2212,6 +2338,8 @@ class ConstVectorNode : public Node
     }
 
     size_type size() const { return vresult.size(); }
+    Epoch written() const { return 0; }
+
     std::string
     str() const
     {
@@ -2300,6 +2428,7 @@ class UnaryNode : public Node
     }
 
     size_type size() const { return l->size(); }
+    Epoch written() const { return l->written(); }
 
     std::string
     str() const
@@ -2398,6 +2527,12 @@ class BinaryNode : public Node
         }
     }
 
+    Epoch
+    written() const
+    {
+        return std::max(l->written(), r->written());
+    }
+
     std::string
     str() const
     {
@@ -2448,6 +2583,7 @@ class SumNode : public Node
     }
 
     size_type size() const { return 1; }
+    Epoch written() const { return l->written(); }
 
     std::string
     str() const
@@ -2763,7 +2899,12 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      * @param n The number of times to add it, defaults to 1.
      */
     template <typename U>
-    void sample(const U &v, int n = 1) { data()->sample(v, n); }
+    void
+    sample(const U &v, int n = 1)
+    {
+        this->touch();
+        data()->sample(v, n);
+    }
 
     /**
      * Return the number of entries in this stat.
@@ -2789,6 +2930,7 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
     void
     reset()
     {
+        this->touch();
         data()->reset(this->info());
     }
 };
@@ -2805,6 +2947,9 @@ class SparseHistStor
         Params() : DistParams(Hist) {}
     };
 
+    /** The result only changes on writes. */
+    static const bool timed = false;
+
   private:
     /** Counter for number of samples */
     Counter samples;
@@ -2899,6 +3044,17 @@ class Formula : public DataWrapVec<Formula, FormulaInfoProxy>
     NodePtr root;
     friend class Temp;
 
+    /**
+     * The last result and total, evaluated when read and kept until
+     * one of the stats in the tree is written.
+     */
+    mutable VResult cachedResult;
+    mutable Result cachedTotal;
+    mutable Epoch cached;
+
+    /** Evaluate the tree again if anything in it changed */
+    void update() const;
+
   public:
     /**
      * Create and initialize thie formula, and register it with the database.
@@ -2959,6 +3115,11 @@ class Formula : public DataWrapVec<Formula, FormulaInfoProxy>
      */
     size_type size() const;
 
+    /**
+     * Return the epoch of the last write to a stat in the tree.
+     */
+    Epoch written() const;
+
     void prepare() { }
 
     /**
@@ -2986,6 +3147,7 @@ class FormulaNode : public Node
     size_type size() const { return formula.size(); }
     const VResult &result() const { formula.result(vec); return vec; }
     Result total() const { return formula.total(); }
+    Epoch written() const { return formula.written(); }
 
     std::string str() const { return formula.str(); }
 };
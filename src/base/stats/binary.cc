@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+
+using namespace std;
+
+namespace Stats {
+
+namespace {
+
+template <typename T>
+void
+put(string &buf, T val)
+{
+    buf.append(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+void
+putString(string &buf, const string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.append(str);
+}
+
+void
+putStrings(string &buf, const vector<string> &strs)
+{
+    put<uint32_t>(buf, strs.size());
+    for (const auto &str : strs)
+        putString(buf, str);
+}
+
+void
+putDistParams(string &buf, const DistData &data)
+{
+    put<uint8_t>(buf, data.type);
+    put<double>(buf, data.min);
+    put<double>(buf, data.max);
+    put<double>(buf, data.bucket_size);
+    put<uint32_t>(buf, data.cvec.size());
+}
+
+/** Value columns taken by a distribution */
+uint32_t
+distColumns(const DistData &data)
+{
+    return 8 + data.cvec.size();
+}
+
+} // anonymous namespace
+
+Binary::Binary(const string &name, bool compress)
+    : name(name), compress(compress), fd(-1), file(nullptr)
+{
+    open();
+}
+
+Binary::~Binary()
+{
+    if (file)
+        gzclose(file);
+}
+
+void
+Binary::open()
+{
+    dir = simout.directory();
+    const string path = simout.resolve(name);
+    fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    // Without compression zlib writes the data as is ("T")
+    if (fd >= 0)
+        file = gzdopen(fd, compress ? "wb6" : "wbT");
+    if (!file)
+        fatal("Unable to open statistics file %s for writing\n", path);
+    gzbuffer(file, 1 << 20);
+
+    record.clear();
+    record.append("gem5stb", 8);
+    put<uint32_t>(record, version);
+    put<uint32_t>(record, 0x01020304);
+    gzwrite(file, record.data(), record.size());
+
+    // Start the new file with a dictionary
+    writtenShape.clear();
+    writtenDistParams.clear();
+}
+
+void
+Binary::relocate()
+{
+    // The file descriptor is shared with the parent of a forked
+    // simulator. Every dump was flushed, but closing the stream would
+    // still end it in the parent's file, so do that on /dev/null.
+    int null_fd = ::open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, fd);
+        ::close(null_fd);
+    }
+    gzclose(file);
+    file = nullptr;
+
+    open();
+}
+
+bool
+Binary::valid() const
+{
+    return file != nullptr;
+}
+
+bool
+Binary::noOutput(const Info &info)
+{
+    return !info.flags.isSet(display);
+}
+
+void
+Binary::add(const Info &info, uint32_t columns)
+{
+    // Text skips a stat whose prerequisite is zero, record whether
+    // that was the case in an extra column
+    if (info.prereq) {
+        row.push_back(info.prereq->zero() ? 1.0 : 0.0);
+        columns++;
+    }
+    infos.push_back(&info);
+    shape.push_back(columns);
+}
+
+void
+Binary::addDist(const DistData &data)
+{
+    distParams.push_back(data.type);
+    distParams.push_back(data.min);
+    distParams.push_back(data.max);
+    distParams.push_back(data.bucket_size);
+
+    row.push_back(data.samples);
+    row.push_back(data.sum);
+    row.push_back(data.squares);
+    row.push_back(data.logs);
+    row.push_back(data.min_val);
+    row.push_back(data.max_val);
+    row.push_back(data.underflow);
+    row.push_back(data.overflow);
+    row.insert(row.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    add(info, 1);
+    row.push_back(info.result());
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    const VResult &vec = info.result();
+    add(info, vec.size() + 1);
+    row.insert(row.end(), vec.begin(), vec.end());
+    row.push_back(info.total());
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    add(info, info.cvec.size() + 1);
+    row.insert(row.end(), info.cvec.begin(), info.cvec.end());
+    row.push_back(info.total());
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    add(info, distColumns(info.data));
+    addDist(info.data);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    uint32_t columns = 0;
+    for (const auto &data : info.data)
+        columns += distColumns(data);
+    add(info, columns);
+    for (const auto &data : info.data)
+        addDist(data);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    add(info, 0);
+    sparse.push_back(info.data.cmap.size());
+    sparse.push_back(info.data.samples);
+    for (const auto &entry : info.data.cmap) {
+        sparse.push_back(entry.first);
+        sparse.push_back(entry.second);
+    }
+}
+
+void
+Binary::begin()
+{
+    // Follow the output directory to a forked simulator's, like the
+    // relocatable files of simout
+    if (!OutputDirectory::isAbsolute(name) && simout.directory() != dir)
+        relocate();
+
+    infos.clear();
+    shape.clear();
+    distParams.clear();
+    row.clear();
+    sparse.clear();
+}
+
+void
+Binary::end()
+{
+    // Bucket names depend on the distribution parameters, which
+    // histograms change as they grow
+    if (shape != writtenShape || distParams != writtenDistParams) {
+        writeDictionary();
+        writtenShape = shape;
+        writtenDistParams = distParams;
+    }
+
+    const uint64_t size = (row.size() + sparse.size()) * sizeof(double);
+    record.clear();
+    put<char>(record, 'R');
+    put<uint64_t>(record, size);
+    gzwrite(file, record.data(), record.size());
+    if (!row.empty())
+        gzwrite(file, row.data(), row.size() * sizeof(double));
+    if (!sparse.empty())
+        gzwrite(file, sparse.data(), sparse.size() * sizeof(double));
+
+    // Make each dump readable on its own, like Text does by flushing
+    if (gzflush(file, Z_SYNC_FLUSH) != Z_OK)
+        warn("Error while writing statistics\n");
+}
+
+void
+Binary::writeDictionary()
+{
+    record.clear();
+    putString(record, Info::separatorString);
+    put<uint32_t>(record, infos.size());
+
+    for (size_t i = 0; i < infos.size(); ++i) {
+        const Info *info = infos[i];
+        const VectorInfo *vector = nullptr;
+        const Vector2dInfo *vector2d = nullptr;
+        const DistInfo *dist = nullptr;
+        const VectorDistInfo *vector_dist = nullptr;
+
+        Kind kind;
+        if (dynamic_cast<const ScalarInfo *>(info)) {
+            kind = ScalarKind;
+        } else if ((vector = dynamic_cast<const VectorInfo *>(info))) {
+            // Formulas are output like vectors
+            kind = dynamic_cast<const FormulaInfo *>(info) ?
+                FormulaKind : VectorKind;
+        } else if ((vector2d = dynamic_cast<const Vector2dInfo *>(info))) {
+            kind = Vector2dKind;
+        } else if ((dist = dynamic_cast<const DistInfo *>(info))) {
+            kind = DistKind;
+        } else if ((vector_dist =
+                    dynamic_cast<const VectorDistInfo *>(info))) {
+            kind = VectorDistKind;
+        } else {
+            kind = SparseHistKind;
+        }
+
+        put<uint8_t>(record, kind);
+        putString(record, info->name);
+        putString(record, info->desc);
+        put<uint16_t>(record, info->flags);
+        put<int32_t>(record, info->precision);
+        put<uint8_t>(record, info->prereq != nullptr);
+        put<uint32_t>(record, shape[i]);
+
+        switch (kind) {
+          case FormulaKind:
+          case VectorKind:
+            put<uint32_t>(record, vector->size());
+            putStrings(record, vector->subnames);
+            putStrings(record, vector->subdescs);
+            break;
+          case Vector2dKind:
+            put<uint32_t>(record, vector2d->x);
+            put<uint32_t>(record, vector2d->y);
+            putStrings(record, vector2d->subnames);
+            putStrings(record, vector2d->subdescs);
+            putStrings(record, vector2d->y_subnames);
+            break;
+          case DistKind:
+            putDistParams(record, dist->data);
+            break;
+          case VectorDistKind:
+            put<uint32_t>(record, vector_dist->data.size());
+            putStrings(record, vector_dist->subnames);
+            putStrings(record, vector_dist->subdescs);
+            for (const auto &data : vector_dist->data)
+                putDistParams(record, data);
+            break;
+          default:
+            break;
+        }
+    }
+
+    writeRecord('D');
+}
+
+void
+Binary::writeRecord(char tag)
+{
+    string header;
+    put<char>(header, tag);
+    put<uint64_t>(header, record.size());
+    gzwrite(file, header.data(), header.size());
+    gzwrite(file, record.data(), record.size());
+}
+
+Output *
+initBinary(const string &filename, bool compress)
+{
+    // Outputs live until the simulator exits, like the Text one
+    return new Binary(filename, compress);
+}
+
+} // namespace Stats
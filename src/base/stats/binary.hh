@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <zlib.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace Stats {
+
+class Info;
+struct DistData;
+
+/**
+ * Statistics output in a binary, columnar format that is cheap to
+ * write and loads straight into an array (see util/stats_bin.py).
+ *
+ * The file starts with the magic "gem5stb\0", a format version and
+ * the value 0x01020304, all written in host byte order, followed by
+ * records made of a one byte tag and a 64-bit payload size:
+ *
+ * - 'D', a dictionary describing every displayed stat in dump order
+ *   and the number of value columns it takes. It is written before
+ *   the first dump and again whenever the layout changes, e.g. when
+ *   a formula changes size or a histogram grows its buckets.
+ * - 'R', the row of one dump: a double per column in dictionary
+ *   order, followed by the entries of the sparse histograms, which
+ *   have no fixed layout.
+ *
+ * The values are the raw ones Text derives its output from, so that
+ * stats.txt can be reproduced from the file. A file with a relative
+ * path is created again in the new output directory of a forked
+ * simulator, like the text output.
+ */
+class Binary : public Output
+{
+  public:
+    static const uint32_t version = 1;
+
+    /** Stat kinds as stored in the dictionary */
+    enum Kind : uint8_t {
+        ScalarKind, VectorKind, DistKind, VectorDistKind, Vector2dKind,
+        FormulaKind, SparseHistKind
+    };
+
+  protected:
+    /** Path the output was requested for and whether to compress */
+    const std::string name;
+    const bool compress;
+
+    /** Output directory the file was opened in */
+    std::string dir;
+    int fd;
+    gzFile file;
+
+    /** Stats visited during the current dump and their column counts */
+    std::vector<const Info *> infos;
+    std::vector<uint32_t> shape;
+    /** Layout the last dictionary was written for */
+    std::vector<uint32_t> writtenShape;
+
+    /** Type, min, max and bucket size of the distributions, which
+     * the dictionary holds as well */
+    std::vector<double> distParams;
+    std::vector<double> writtenDistParams;
+
+    /** Values of the current dump */
+    std::vector<double> row;
+    /** Entry count followed by key, count pairs per sparse histogram */
+    std::vector<double> sparse;
+
+    /** Serialization buffer for a record */
+    std::string record;
+
+    bool noOutput(const Info &info);
+    void add(const Info &info, uint32_t columns);
+    void addDist(const DistData &data);
+
+    void open();
+    void relocate();
+
+    void writeDictionary();
+    void writeRecord(char tag);
+
+  public:
+    /**
+     * @param name Path of the output file, relative to the output
+     * directory unless absolute
+     * @param compress Compress the output with zlib
+     */
+    Binary(const std::string &name, bool compress);
+    ~Binary();
+
+    // Implement Visit
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+    // Implement Output
+    bool valid() const override;
+    void begin() override;
+    void end() override;
+};
+
+Output *initBinary(const std::string &filename, bool compress);
+
+} // namespace Stats
+
+#endif // __BASE_STATS_BINARY_HH__
@@ -66,6 +66,17 @@ const FlagsType __reserved =    init | display;
 struct StorageParams;
 struct Output;
 
+/**
+ * The current write epoch. Stats remember the epoch of their last
+ * write, so dumps, resets and formulas can skip the ones that did not
+ * change since they last looked at them. Whoever looks takes a new
+ * epoch, writes after that are then newer than what it saw.
+ */
+extern Epoch curEpoch;
+
+/** Start a new write epoch. @return The new epoch. */
+inline Epoch newEpoch() { return ++curEpoch; }
+
 class Info
 {
   public:
@@ -128,6 +139,12 @@ class Info
      */
     virtual bool zero() const = 0;
 
+    /**
+     * @return The epoch of the last change to the value of this stat.
+     * Stats that are computed when read always look changed.
+     */
+    virtual Epoch written() const { return curEpoch; }
+
     /**
      * Visitor entry for outputing statistics data
      */
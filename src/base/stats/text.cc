@@ -85,18 +85,21 @@ namespace Stats {
 std::list<Info *> &statsList();
 
 Text::Text()
-    : mystream(false), stream(NULL), descriptions(false)
+    : mystream(false), stream(NULL), descriptions(false),
+      skipUnchanged(false), lastDump(0)
 {
 }
 
 Text::Text(std::ostream &stream)
-    : mystream(false), stream(NULL), descriptions(false)
+    : mystream(false), stream(NULL), descriptions(false),
+      skipUnchanged(false), lastDump(0)
 {
     open(stream);
 }
 
 Text::Text(const std::string &file)
-    : mystream(false), stream(NULL), descriptions(false)
+    : mystream(false), stream(NULL), descriptions(false),
+      skipUnchanged(false), lastDump(0)
 {
     open(file);
 }
@@ -151,6 +154,7 @@ Text::end()
 {
     ccprintf(*stream, "\n---------- End Simulation Statistics   ----------\n");
     stream->flush();
+    lastDump = newEpoch();
 }
 
 bool
@@ -162,6 +166,9 @@ Text::noOutput(const Info &info)
     if (info.prereq && info.prereq->zero())
         return true;
 
+    if (skipUnchanged && info.written() < lastDump)
+        return true;
+
     return false;
 }
 
@@ -736,7 +743,7 @@ Text::visit(const SparseHistInfo &info)
 }
 
 Output *
-initText(const string &filename, bool desc)
+initText(const string &filename, bool desc, bool skip_unchanged)
 {
     static Text text;
     static bool connected = false;
@@ -744,6 +751,7 @@ initText(const string &filename, bool desc)
     if (!connected) {
         text.open(*simout.findOrCreate(filename)->stream());
         text.descriptions = desc;
+        text.skipUnchanged = skip_unchanged;
         connected = true;
     }
 
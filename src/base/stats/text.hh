@@ -51,6 +51,12 @@ class Text : public Output
 
   public:
     bool descriptions;
+    /** Leave out the stats that were not written since the last dump */
+    bool skipUnchanged;
+
+  protected:
+    /** Epoch at the end of the last dump */
+    Epoch lastDump;
 
   public:
     Text();
@@ -78,7 +84,8 @@ class Text : public Output
 
 std::string ValueToString(Result value, int precision);
 
-Output *initText(const std::string &filename, bool desc);
+Output *initText(const std::string &filename, bool desc,
+                 bool skip_unchanged = false);
 
 } // namespace Stats
 
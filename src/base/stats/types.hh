@@ -56,6 +56,9 @@ typedef std::vector<Result> VResult;
 typedef unsigned int size_type;
 typedef unsigned int off_type;
 
+/** Write epochs, used to find the stats that changed. */
+typedef uint64_t Epoch;
+
 } // namespace Stats
 
 #endif // __BASE_STATS_TYPES_HH__
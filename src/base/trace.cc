@@ -35,12 +35,19 @@
 
 #include "base/trace.hh"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <cctype>
+#include <cerrno>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
 
+#include "base/callback.hh"
 #include "base/debug.hh"
 #include "base/logging.hh"
 #include "base/output.hh"
@@ -157,4 +164,283 @@ OstreamLogger::logMessage(Tick when, const std::string &name,
     stream.flush();
 }
 
+int
+LineBuf::overflow(int c)
+{
+    if (c == traits_type::eof())
+        return traits_type::not_eof(c);
+
+    line.push_back(c);
+    if (c == '\n') {
+        // Raw output, like the exec tracer's, carries its own tick
+        logger.logMessage(MaxTick, std::string(), line);
+        line.clear();
+    }
+    return c;
+}
+
+void
+BinaryRecord::putHeader()
+{
+    buf.append("gem5trc", 8);
+    put<uint32_t>(version);
+    put<uint32_t>(0x01020304);
+}
+
+void
+BinaryRecord::putDefinition(Tag tag, uint32_t id, const std::string &str)
+{
+    put(tag);
+    put<uint32_t>(id);
+    putString(str.data(), str.size());
+}
+
+void
+BinaryRecord::putText(Tag tag, Tick when, uint32_t name,
+                      const char *data, size_t len)
+{
+    put(tag);
+    put<uint64_t>(when);
+    put<uint32_t>(name);
+    putString(data, len);
+}
+
+std::pair<uint32_t, const std::string *>
+StringTable::intern(const std::string &str, bool &added)
+{
+    auto it = ids.emplace(str, strings.size());
+    added = it.second;
+    if (added)
+        strings.push_back(&it.first->first);
+    return std::make_pair(it.first->second, &it.first->first);
+}
+
+BinaryLogger::BinaryLogger(const std::string &filename)
+    : file(simout.create(filename, true)), lineBuf(*this), stream(&lineBuf)
+{
+    mode = BinaryMode;
+    buf.reserve(flushSize + 4096);
+    BinaryRecord(buf).putHeader();
+
+    // Loggers are never deleted, write the tail of the trace out when
+    // the simulator exits
+    registerExitCallback(
+        new MakeCallback<BinaryLogger, &BinaryLogger::flush>(this));
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    flush();
+    simout.close(file);
+}
+
+uint32_t
+BinaryLogger::defineName(const std::string &name)
+{
+    bool added;
+    auto entry = names.intern(name, added);
+    if (added)
+        BinaryRecord(buf).putDefinition(BinaryRecord::TagName,
+                                        entry.first, name);
+    nameIds.insert(name, entry.first);
+    return entry.first;
+}
+
+uint32_t
+BinaryLogger::defineFormat(const char *fmt)
+{
+    bool added;
+    auto entry = formats.intern(fmt, added);
+    if (added)
+        BinaryRecord(buf).putDefinition(BinaryRecord::TagFormat,
+                                        entry.first, *entry.second);
+    formatIds.insert(fmt, entry);
+    return entry.first;
+}
+
+void
+BinaryLogger::dump(Tick when, const std::string &name, const void *d, int len)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    // The decoder prints the same hex dump as Logger::dump
+    const uint32_t name_id = nameId(name);
+    BinaryRecord(buf).putText(BinaryRecord::TagDump, when, name_id,
+                              static_cast<const char *>(d), len);
+    endRecord();
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+                         const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    const uint32_t name_id = nameId(name);
+    BinaryRecord(buf).putText(BinaryRecord::TagText, when, name_id,
+                              message.data(), message.size());
+    endRecord();
+}
+
+void
+BinaryLogger::flush()
+{
+    if (buf.empty())
+        return;
+
+    std::ostream &os = *file->stream();
+    os.write(buf.data(), buf.size());
+    os.flush();
+    buf.clear();
+}
+
+__thread RingLogger::Ring *RingLogger::localRing = nullptr;
+
+RingLogger::RingLogger(const std::string &filename, size_t size)
+    : path(simout.resolve(filename)), size(size),
+      lineBuf(*this), stream(&lineBuf)
+{
+    mode = RingMode;
+    if (size == 0)
+        fatal("The debug ring buffer needs room for at least one message\n");
+}
+
+RingLogger::Ring &
+RingLogger::newRing()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    // Rings are only freed with the process, a crash dump may look at
+    // them at any time
+    localRing = new Ring(this, rings.size(), size);
+    rings.push_back(localRing);
+    return *localRing;
+}
+
+uint32_t
+RingLogger::defineName(Ring &r, const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    bool added;
+    auto entry = names.intern(name, added);
+    r.nameIds.insert(name, entry.first);
+    return entry.first;
+}
+
+uint32_t
+RingLogger::defineFormat(Ring &r, const char *fmt)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    bool added;
+    auto entry = formats.intern(fmt, added);
+    r.formatIds.insert(fmt, entry);
+    return entry.first;
+}
+
+void
+RingLogger::putText(BinaryRecord::Tag tag, Tick when, const std::string &name,
+                    const char *data, size_t len)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    Ring &r = ring();
+    const uint32_t name_id = nameId(r, name);
+    BinaryRecord(r.slot()).putText(tag, when, name_id, data, len);
+    r.commit();
+}
+
+void
+RingLogger::dump(Tick when, const std::string &name, const void *d, int len)
+{
+    putText(BinaryRecord::TagDump, when, name,
+            static_cast<const char *>(d), len);
+}
+
+void
+RingLogger::logMessage(Tick when, const std::string &name,
+                       const std::string &message)
+{
+    putText(BinaryRecord::TagText, when, name,
+            message.data(), message.size());
+}
+
+namespace {
+
+void
+writeAll(int fd, const std::string &data)
+{
+    const char *p = data.data();
+    size_t left = data.size();
+    while (left) {
+        ssize_t n = ::write(fd, p, left);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        p += n;
+        left -= n;
+    }
+}
+
+} // anonymous namespace
+
+void
+RingLogger::crashDump()
+{
+    // This may run in a signal handler, or while another thread is
+    // recording. Don't take the lock, and use plain system calls to
+    // write the file. The strings below may allocate, but the
+    // simulator is dying anyway.
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        ccprintf(std::cerr, "Failed to open %s for the debug ring buffers\n",
+                 path);
+        return;
+    }
+
+    std::string buf;
+    BinaryRecord record(buf);
+    record.putHeader();
+    const uint32_t num_names = names.all().size();
+    for (uint32_t i = 0; i < num_names; ++i)
+        record.putDefinition(BinaryRecord::TagName, i, *names.all()[i]);
+    // An empty name for the lines below
+    record.putDefinition(BinaryRecord::TagName, num_names, std::string());
+    for (size_t i = 0; i < formats.all().size(); ++i)
+        record.putDefinition(BinaryRecord::TagFormat, i, *formats.all()[i]);
+    writeAll(fd, buf);
+
+    for (const Ring *r : rings) {
+        const size_t slots = r->slots.size();
+        const size_t n = std::min<uint64_t>(r->count, slots - 1);
+
+        // A raw line to tell the threads apart
+        char header[128];
+        int len = snprintf(header, sizeof(header),
+                           "---- thread %d: last %zu of %llu messages\n",
+                           r->thread, n, (unsigned long long)r->count);
+        buf.clear();
+        record.putText(BinaryRecord::TagText, MaxTick, num_names,
+                       header, len);
+        writeAll(fd, buf);
+
+        for (size_t i = 0; i < n; ++i)
+            writeAll(fd, r->slots[(r->next + slots - n + i) % slots]);
+    }
+
+    ::close(fd);
+    ccprintf(std::cerr, "Wrote the last debug messages to %s\n", path);
+}
+
+void
+crashDump()
+{
+    static std::atomic<bool> dumped(false);
+    if (debug_logger && !dumped.exchange(true))
+        debug_logger->crashDump();
+}
+
 } // namespace Trace
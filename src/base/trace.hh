@@ -36,16 +36,29 @@
 #ifndef __BASE_TRACE_HH__
 #define __BASE_TRACE_HH__
 
+#include <atomic>
+#include <cstring>
+#include <mutex>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/cprintf.hh"
 #include "base/debug.hh"
+#include "base/flat_hash_map.hh"
 #include "base/match.hh"
 #include "base/types.hh"
 #include "sim/core.hh"
 
+class OutputStream;
+
 namespace Trace {
 
+class BinaryLogger;
+class RingLogger;
+
 /** Debug logging base class.  Handles formatting and outputting
  *  time/name/message messages */
 class Logger
@@ -54,19 +67,23 @@ class Logger
     /** Name match for objects to ignore */
     ObjectMatch ignore;
 
+    /** How dprintf hands messages to the logger */
+    enum Mode {
+        /** Formatted, to logMessage */
+        TextMode,
+        /** Unformatted, to BinaryLogger::record */
+        BinaryMode,
+        /** Unformatted, to RingLogger::record */
+        RingMode,
+    };
+
+    Mode mode = TextMode;
+
   public:
     /** Log a single message */
     template <typename ...Args>
     void dprintf(Tick when, const std::string &name, const char *fmt,
-                 const Args &...args)
-    {
-        if (!name.empty() && ignore.match(name))
-            return;
-
-        std::ostringstream line;
-        ccprintf(line, fmt, args...);
-        logMessage(when, name, line.str());
-    }
+                 const Args &...args);
 
     /** Dump a block of data of length len */
     virtual void dump(Tick when, const std::string &name,
@@ -86,6 +103,10 @@ class Logger
     /** Set objects to ignore */
     void setIgnore(ObjectMatch &ignore_) { ignore = ignore_; }
 
+    /** Write out any messages held back, the simulator is about to die.
+     *  This may be called from a signal handler */
+    virtual void crashDump() { }
+
     virtual ~Logger() { }
 };
 
@@ -106,6 +127,532 @@ class OstreamLogger : public Logger
     std::ostream &getOstream() override { return stream; }
 };
 
+/** Collects output to a logger's ostream and logs it a line at a time */
+class LineBuf : public std::streambuf
+{
+  protected:
+    Logger &logger;
+    std::string line;
+
+    int overflow(int c) override;
+
+  public:
+    LineBuf(Logger &logger) : logger(logger) {}
+};
+
+/**
+ * Converts only to T, through a conversion function template, so it
+ * can't take part in the built-in integer overloads of operator<<.
+ */
+template <typename T>
+struct EnumProbe
+{
+    template <typename U, typename = typename std::enable_if<
+                              std::is_same<U, T>::value>::type>
+    operator U() const;
+};
+
+/**
+ * Whether T is an enum with its own ostream operator<<, like the
+ * SLICC generated ones, rather than one printing as an integer.
+ */
+template <typename T>
+class HasEnumPrinter
+{
+  private:
+    template <typename U>
+    static auto test(int) -> decltype(
+        std::declval<std::ostream &>() << std::declval<EnumProbe<U>>(),
+        std::true_type());
+
+    template <typename U>
+    static std::false_type test(...);
+
+  public:
+    static constexpr bool value =
+        std::is_enum<T>::value && decltype(test<T>(0))::value;
+};
+
+/**
+ * Writer of the records of binary traces to a buffer. A message is
+ * recorded as its tick, the ids of the object name and of the format
+ * string, and the raw bytes of the arguments, each tagged with its
+ * type. Arguments of class types, and enums with their own
+ * operator<<, are formatted when they are recorded.
+ */
+class BinaryRecord
+{
+  public:
+    /** Record tags */
+    enum Tag : uint8_t {
+        TagName = 'N',
+        TagFormat = 'F',
+        TagMessage = 'M',
+        TagDump = 'D',
+        TagText = 'T',
+    };
+
+    /** Argument type tags */
+    enum ArgType : uint8_t {
+        ArgEnd = 0,
+        ArgInt,
+        ArgSigned,
+        ArgUnsigned,
+        ArgChar,
+        ArgUChar,
+        ArgBool,
+        ArgFloat,
+        ArgString,
+        ArgPointer,
+        ArgOther,
+    };
+
+    static const uint32_t version = 1;
+
+  protected:
+    std::string &buf;
+
+  public:
+    BinaryRecord(std::string &buf) : buf(buf) {}
+
+    template <typename T>
+    void
+    put(T val)
+    {
+        buf.append(reinterpret_cast<const char *>(&val), sizeof(val));
+    }
+
+    void
+    putString(const char *str, size_t len)
+    {
+        put<uint32_t>(len);
+        buf.append(str, len);
+    }
+
+    /** Start of a trace file */
+    void putHeader();
+
+    /** Name or format string definition */
+    void putDefinition(Tag tag, uint32_t id, const std::string &str);
+
+    /** Logged text or dumped data */
+    void putText(Tag tag, Tick when, uint32_t name,
+                 const char *data, size_t len);
+
+    template <typename ...Args>
+    void
+    putMessage(Tick when, uint32_t name, uint32_t fmt, const Args &...args)
+    {
+        put(TagMessage);
+        put<uint64_t>(when);
+        put<uint32_t>(name);
+        put<uint32_t>(fmt);
+        putArgs(args...);
+    }
+
+  protected:
+    void putArg(bool v) { put(ArgBool); put<uint8_t>(v); }
+    void putArg(char v) { put(ArgChar); put<int8_t>(v); }
+    void putArg(signed char v) { put(ArgChar); put<int8_t>(v); }
+    void putArg(unsigned char v) { put(ArgUChar); put<uint8_t>(v); }
+    // Only int arguments can give a '*' width or precision
+    void putArg(int v) { put(ArgInt); put<int64_t>(v); }
+
+    void
+    putArg(const std::string &v)
+    {
+        put(ArgString);
+        putString(v.data(), v.size());
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value>::type
+    putArg(T v)
+    {
+        if (std::is_signed<T>::value) {
+            // Negative values print in hex with the width of their type
+            put(ArgSigned);
+            put<uint8_t>(sizeof(T));
+            put<int64_t>(v);
+        } else {
+            put(ArgUnsigned);
+            put<uint64_t>(v);
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_enum<T>::value &&
+                            !HasEnumPrinter<T>::value>::type
+    putArg(T v)
+    {
+        putArg(static_cast<typename std::underlying_type<T>::type>(v));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    putArg(T v)
+    {
+        put(ArgFloat);
+        put<double>(v);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_pointer<T>::value>::type
+    putArg(T v)
+    {
+        typedef typename std::remove_cv<
+            typename std::remove_pointer<T>::type>::type Pointee;
+        // ostreams print all the char pointers as strings
+        if (sizeof(Pointee) == 1 && std::is_integral<Pointee>::value &&
+            !std::is_same<Pointee, bool>::value && v) {
+            const char *str = reinterpret_cast<const char *>(v);
+            put(ArgString);
+            putString(str, std::strlen(str));
+        } else {
+            put(ArgPointer);
+            put<uint64_t>(reinterpret_cast<uintptr_t>(v));
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_class<T>::value ||
+                            HasEnumPrinter<T>::value>::type
+    putArg(const T &v)
+    {
+        std::ostringstream text;
+        text << v;
+        put(ArgOther);
+        const std::string &str = text.str();
+        putString(str.data(), str.size());
+    }
+
+    void putArgs() { put(ArgEnd); }
+
+    template <typename T, typename ...Args>
+    void
+    putArgs(const T &arg, const Args &...args)
+    {
+        putArg(arg);
+        putArgs(args...);
+    }
+};
+
+/**
+ * Ids of the names and format strings of a binary trace. The strings
+ * live as long as the table.
+ */
+class StringTable
+{
+  protected:
+    std::unordered_map<std::string, uint32_t> ids;
+    std::vector<const std::string *> strings;
+
+  public:
+    /**
+     * Get the id of a string, adding it to the table if needed.
+     *
+     * @param str The string.
+     * @param added Set to whether the string was added.
+     * @return The id and the copy of the string held by the table.
+     */
+    std::pair<uint32_t, const std::string *>
+    intern(const std::string &str, bool &added);
+
+    const std::vector<const std::string *> &all() const { return strings; }
+};
+
+/**
+ * Cache of the ids of names by their contents. Names are mostly the
+ * name() of a SimObject, which returns a new string every time.
+ */
+class NameIdCache
+{
+  protected:
+    FlatHashMap<std::string, uint32_t> entries;
+
+  public:
+    /** Find the id of a name, returns false if it is not cached */
+    bool
+    find(const std::string &name, uint32_t &id) const
+    {
+        auto it = entries.find(name);
+        if (it == entries.end())
+            return false;
+        id = it->second;
+        return true;
+    }
+
+    void
+    insert(const std::string &name, uint32_t id)
+    {
+        entries[name] = id;
+    }
+};
+
+/**
+ * Cache of the ids of format strings by the address of their
+ * characters. Formats are string literals, which live as long as the
+ * simulation. The contents are checked anyway, in case the address
+ * was reused.
+ */
+class FormatIdCache
+{
+  protected:
+    FlatHashMap<const char *,
+                std::pair<uint32_t, const std::string *>> entries;
+
+  public:
+    /** Find the id of a format, returns false if it is not cached */
+    bool
+    find(const char *str, uint32_t &id) const
+    {
+        auto it = entries.find(str);
+        if (it == entries.end() ||
+            std::strcmp(it->second.second->c_str(), str) != 0) {
+            return false;
+        }
+        id = it->second.first;
+        return true;
+    }
+
+    void
+    insert(const char *str, std::pair<uint32_t, const std::string *> entry)
+    {
+        entries[str] = entry;
+    }
+};
+
+/**
+ * Logger that stores messages in a binary file without formatting
+ * them, see BinaryRecord. Names and format strings are written the
+ * first time they are seen. util/decode_trace.py renders the file as
+ * the text OstreamLogger would have printed.
+ */
+class BinaryLogger : public Logger
+{
+  protected:
+    OutputStream *file;
+    /** Records not yet written to the file */
+    std::string buf;
+
+    StringTable names;
+    StringTable formats;
+    NameIdCache nameIds;
+    FormatIdCache formatIds;
+
+    LineBuf lineBuf;
+    std::ostream stream;
+
+    /** Write the records to the file once enough have accumulated */
+    void
+    endRecord()
+    {
+        if (buf.size() >= flushSize)
+            flush();
+    }
+
+    uint32_t defineName(const std::string &name);
+    uint32_t defineFormat(const char *fmt);
+
+    uint32_t
+    nameId(const std::string &name)
+    {
+        uint32_t id;
+        return nameIds.find(name, id) ? id : defineName(name);
+    }
+
+    uint32_t
+    formatId(const char *fmt)
+    {
+        uint32_t id;
+        return formatIds.find(fmt, id) ? id : defineFormat(fmt);
+    }
+
+  public:
+    /** Size of the records to collect before writing them out */
+    static const size_t flushSize = 1 << 20;
+
+    BinaryLogger(const std::string &filename);
+    ~BinaryLogger();
+
+    /** Record a dprintf message */
+    template <typename ...Args>
+    void
+    record(Tick when, const std::string &name, const char *fmt,
+           const Args &...args)
+    {
+        const uint32_t name_id = nameId(name);
+        const uint32_t format_id = formatId(fmt);
+        BinaryRecord(buf).putMessage(when, name_id, format_id, args...);
+        endRecord();
+    }
+
+    void dump(Tick when, const std::string &name,
+              const void *d, int len) override;
+
+    void logMessage(Tick when, const std::string &name,
+                    const std::string &message) override;
+
+    std::ostream &getOstream() override { return stream; }
+
+    void crashDump() override { flush(); }
+
+    /** Write out all the recorded messages */
+    void flush();
+};
+
+/**
+ * Flight recorder: a logger that keeps the last messages of each
+ * thread in memory, in the format of BinaryLogger, and only writes
+ * them to a file when the simulator dies (see Trace::crashDump()).
+ */
+class RingLogger : public Logger
+{
+  protected:
+    /** The messages of a thread, and its cache of string ids */
+    struct Ring
+    {
+        const RingLogger *owner;
+        int thread;
+        /**
+         * Encoded records. The one at next is being written, the ones
+         * after it are the oldest once the ring has wrapped around.
+         */
+        std::vector<std::string> slots;
+        size_t next;
+        uint64_t count;
+
+        NameIdCache nameIds;
+        FormatIdCache formatIds;
+
+        Ring(const RingLogger *owner, int thread, size_t size)
+            : owner(owner), thread(thread), slots(size + 1), next(0),
+              count(0)
+        {}
+
+        /** Buffer for the next record */
+        std::string &
+        slot()
+        {
+            std::string &s = slots[next];
+            s.clear();
+            return s;
+        }
+
+        /** Add the record written to slot() */
+        void
+        commit()
+        {
+            // A crash dump from a signal handler must not see the slot
+            // before it is complete
+            std::atomic_signal_fence(std::memory_order_release);
+            if (++next == slots.size())
+                next = 0;
+            ++count;
+        }
+    };
+
+    static __thread Ring *localRing;
+
+    const std::string path;
+    const size_t size;
+
+    /** Protects the tables and the list of rings */
+    std::mutex mutex;
+    StringTable names;
+    StringTable formats;
+    std::vector<Ring *> rings;
+
+    LineBuf lineBuf;
+    std::ostream stream;
+
+    Ring &newRing();
+
+    Ring &
+    ring()
+    {
+        Ring *r = localRing;
+        return r && r->owner == this ? *r : newRing();
+    }
+
+    uint32_t defineName(Ring &r, const std::string &name);
+    uint32_t defineFormat(Ring &r, const char *fmt);
+
+    uint32_t
+    nameId(Ring &r, const std::string &name)
+    {
+        uint32_t id;
+        return r.nameIds.find(name, id) ? id : defineName(r, name);
+    }
+
+    uint32_t
+    formatId(Ring &r, const char *fmt)
+    {
+        uint32_t id;
+        return r.formatIds.find(fmt, id) ? id : defineFormat(r, fmt);
+    }
+
+    void putText(BinaryRecord::Tag tag, Tick when, const std::string &name,
+                 const char *data, size_t len);
+
+  public:
+    /**
+     * @param filename File in the output directory to write the
+     *                 messages to.
+     * @param size Number of messages to keep per thread.
+     */
+    RingLogger(const std::string &filename, size_t size);
+
+    /** Record a dprintf message */
+    template <typename ...Args>
+    void
+    record(Tick when, const std::string &name, const char *fmt,
+           const Args &...args)
+    {
+        Ring &r = ring();
+        const uint32_t name_id = nameId(r, name);
+        const uint32_t format_id = formatId(r, fmt);
+        BinaryRecord(r.slot()).putMessage(when, name_id, format_id,
+                                          args...);
+        r.commit();
+    }
+
+    void dump(Tick when, const std::string &name,
+              const void *d, int len) override;
+
+    void logMessage(Tick when, const std::string &name,
+                    const std::string &message) override;
+
+    std::ostream &getOstream() override { return stream; }
+
+    /** Write the messages in the rings to the file */
+    void crashDump() override;
+};
+
+template <typename ...Args>
+void
+Logger::dprintf(Tick when, const std::string &name, const char *fmt,
+                const Args &...args)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    switch (mode) {
+      case BinaryMode:
+        static_cast<BinaryLogger *>(this)->record(when, name, fmt, args...);
+        return;
+      case RingMode:
+        static_cast<RingLogger *>(this)->record(when, name, fmt, args...);
+        return;
+      default:
+        break;
+    }
+
+    std::ostringstream line;
+    ccprintf(line, fmt, args...);
+    logMessage(when, name, line.str());
+}
+
 /** Get the current global debug logger.  This takes ownership of the given
  *  logger which should be allocated using 'new' */
 Logger *getDebugLogger();
@@ -116,6 +663,11 @@ std::ostream &output();
 /** Delete the current global logger and assign a new one */
 void setDebugLogger(Logger *logger);
 
+/** Have the current global logger write out the messages it holds
+ *  back, the simulator is about to die. Only the first call does
+ *  anything. */
+void crashDump();
+
 /** Enable/disable debug logging */
 void enable();
 void disable();
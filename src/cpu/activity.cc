@@ -122,6 +122,19 @@ ActivityRecorder::deactivateStage(const int idx)
     assert(activityCount >= 0);
 }
 
+bool
+ActivityRecorder::commInFlight() const
+{
+    int active_stages = 0;
+    for (int i = 0; i < numStages; ++i) {
+        if (stageActive[i]) {
+            active_stages++;
+        }
+    }
+
+    return activityCount > active_stages;
+}
+
 void
 ActivityRecorder::reset()
 {
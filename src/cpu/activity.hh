@@ -89,6 +89,17 @@ class ActivityRecorder
     /** Returns if the CPU should be active. */
     bool active() { return activityCount; }
 
+    /** Returns if any stage recorded activity in the current cycle.
+     *  Must be called before advance().
+     */
+    bool activeThisCycle() const { return activityBuffer[0]; }
+
+    /** Returns if any time buffer still holds communication that has
+     *  not yet reached its destination, i.e. if the activity count is
+     *  not made up solely of active stages.
+     */
+    bool commInFlight() const;
+
     /** Clears the time buffer and the activity count. */
     void reset();
 
@@ -252,7 +252,7 @@ BaseCPU::BaseCPU(Params *p, bool is_checker)
 
     if (FullSystem) {
         if (params()->profile)
-            profileEvent = new EventFunctionWrapper(
+            profileEvent = new PeriodicEvent(
                 [this]{ processProfileEvent(); },
                 name());
     }
@@ -318,7 +318,7 @@ BaseCPU::mwaitAtomic(ThreadID tid, ThreadContext *tc, BaseTLB *dtb)
     assert(tid < numThreads);
     AddressMonitor &monitor = addressMonitor[tid];
 
-    RequestPtr req = std::make_shared<Request>();
+    RequestPtr req = makeRequest();
 
     Addr addr = monitor.vAddr;
     int block_size = cacheLineSize();
@@ -359,7 +359,7 @@ BaseCPU::startup()
 {
     if (FullSystem) {
         if (!params()->switched_out && profileEvent)
-            schedule(profileEvent, curTick());
+            profileEvent->start(eventQueue(), curTick(), params()->profile);
     }
 
     if (params()->progress_interval) {
@@ -573,8 +573,8 @@ BaseCPU::switchOut()
 {
     assert(!_switchedOut);
     _switchedOut = true;
-    if (profileEvent && profileEvent->scheduled())
-        deschedule(profileEvent);
+    if (profileEvent)
+        profileEvent->stop();
 
     // Flush all TLBs in the CPU to avoid having stale translations if
     // it gets switched in later.
@@ -696,7 +696,7 @@ BaseCPU::takeOverFrom(BaseCPU *oldCPU)
             threadContexts[i]->profileClear();
 
         if (profileEvent)
-            schedule(profileEvent, curTick());
+            profileEvent->start(eventQueue(), curTick(), params()->profile);
     }
 
     // All CPUs have an instruction and a data port, and the new CPU's
@@ -739,8 +739,6 @@ BaseCPU::processProfileEvent()
 
     for (ThreadID i = 0; i < size; ++i)
         threadContexts[i]->profileSample();
-
-    schedule(profileEvent, curTick() + params()->profile);
 }
 
 void
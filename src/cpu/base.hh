@@ -250,7 +250,7 @@ class BaseCPU : public MemObject
     }
 
     void processProfileEvent();
-    EventFunctionWrapper * profileEvent;
+    PeriodicEvent * profileEvent;
 
   protected:
     std::vector<ThreadContext *> threadContexts;
@@ -1214,7 +1214,7 @@ BaseDynInst<Impl>::initiateMemRead(Addr addr, unsigned size,
         sreqLow = savedSreqLow;
         sreqHigh = savedSreqHigh;
     } else {
-        req = std::make_shared<Request>(
+        req = makeRequest(
             asid, addr, size, flags, masterId(),
             this->pc.instAddr(), thread->contextId());
 
@@ -1234,7 +1234,7 @@ BaseDynInst<Impl>::initiateMemRead(Addr addr, unsigned size,
             instFlags[EffAddrValid] = true;
             if (req->getVaddr() != addr) panic("addr not equal!");
             if (cpu->checker) {
-                reqToVerify = std::make_shared<Request>(*req);
+                reqToVerify = makeRequest(*req);
             }
             fault = cpu->read(req, sreqLow, sreqHigh, lqIdx);
         } else {
@@ -1268,7 +1268,7 @@ BaseDynInst<Impl>::writeMem(uint8_t *data, unsigned size, Addr addr,
         sreqLow = savedSreqLow;
         sreqHigh = savedSreqHigh;
     } else {
-        req = std::make_shared<Request>(
+        req = makeRequest(
             asid, addr, size, flags, masterId(),
             this->pc.instAddr(), thread->contextId());
 
@@ -1287,7 +1287,7 @@ BaseDynInst<Impl>::writeMem(uint8_t *data, unsigned size, Addr addr,
         instFlags[EffAddrValid] = true;
 
         if (cpu->checker) {
-            reqToVerify = std::make_shared<Request>(*req);
+            reqToVerify = makeRequest(*req);
         }
         fault = cpu->write(req, sreqLow, sreqHigh, data, sqIdx);
     }
@@ -155,7 +155,7 @@ CheckerCPU::readMem(Addr addr, uint8_t *data, unsigned size,
 
     // Need to account for multiple accesses like the Atomic and TimingSimple
     while (1) {
-        auto mem_req = std::make_shared<Request>(
+        auto mem_req = makeRequest(
             0, addr, size, flags, masterId,
             thread->pcState().instAddr(), tc->contextId());
 
@@ -236,7 +236,7 @@ CheckerCPU::writeMem(uint8_t *data, unsigned size,
 
     // Need to account for a multiple access like Atomic and Timing CPUs
     while (1) {
-        auto mem_req = std::make_shared<Request>(
+        auto mem_req = makeRequest(
             0, addr, size, flags, masterId,
             thread->pcState().instAddr(), tc->contextId());
 
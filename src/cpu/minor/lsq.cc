@@ -84,7 +84,7 @@ LSQ::LSQRequest::LSQRequest(LSQ &port_, MinorDynInstPtr inst_, bool isLoad_,
     issuedToMemory(false),
     state(NotIssued)
 {
-    request = std::make_shared<Request>();
+    request = makeRequest();
 }
 
 LSQ::AddrRangeCoverage
@@ -419,7 +419,7 @@ LSQ::SplitDataRequest::makeFragmentRequests()
             }
         }
 
-        RequestPtr fragment = std::make_shared<Request>();
+        RequestPtr fragment = makeRequest();
 
         fragment->setContext(request->contextId());
         fragment->setVirt(0 /* asid */,
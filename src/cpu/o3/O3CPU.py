@@ -65,6 +65,8 @@ class DerivO3CPU(BaseCPU):
         return True
 
     activity = Param.Unsigned(0, "Initial count")
+    idleSkip = Param.Bool(False, "Deschedule the CPU during cycles in which "
+        "no stage can make progress until an external event wakes it up")
 
     cacheStorePorts = Param.Unsigned(200, "Cache Ports. "
           "Constrains stores only. Loads are constrained by load FUs.")
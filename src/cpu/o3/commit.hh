@@ -50,6 +50,7 @@
 #include "base/statistics.hh"
 #include "cpu/exetrace.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/o3/cycle_stats.hh"
 #include "cpu/simple/WordFM.hh"
 #include "cpu/timebuf.hh"
 #include "sim/probe/probe.hh"
@@ -218,6 +219,9 @@ class DefaultCommit
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Accounts for cycles the CPU skipped while quiescent. */
+    void skipCycles(Cycles cycles);
+
     /** Deschedules a thread from scheduling */
     void deactivateThread(ThreadID tid);
 
@@ -496,6 +500,12 @@ class DefaultCommit
         a possible livelock senario.  */
     bool avoidQuiesceLiveLock;
 
+    /** Per-cycle stats incremented in the last tick. */
+    CycleStats cycleStats;
+
+    /** ROB reads before the last tick, to replay them for skipped cycles. */
+    Counter robReadsAtTick;
+
     /** Updates commit stats based on this instruction. */
     void updateComInstStats(DynInstPtr &inst);
 
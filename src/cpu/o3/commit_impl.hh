@@ -84,6 +84,10 @@ DefaultCommit<Impl>::processTrapEvent(ThreadID tid)
     // This will get reset by commit if it was switched out at the
     // time of this event processing.
     trapSquash[tid] = true;
+
+    // The CPU may have descheduled itself waiting for the trap.
+    if (!cpu->switchedOut())
+        cpu->wakeCPU();
 }
 
 template <class Impl>
@@ -100,7 +104,8 @@ DefaultCommit<Impl>::DefaultCommit(O3CPU *_cpu, DerivO3CPUParams *params)
       drainImminent(false),
       trapLatency(params->trapLatency),
       canHandleInterrupts(true),
-      avoidQuiesceLiveLock(false)
+      avoidQuiesceLiveLock(false),
+      robReadsAtTick(0)
 {
     if (commitWidth > Impl::MaxWidth)
         fatal("commitWidth (%d) is larger than compiled limit (%d),\n"
@@ -471,6 +476,19 @@ DefaultCommit<Impl>::takeOverFrom()
     rob->takeOverFrom();
 }
 
+template <class Impl>
+void
+DefaultCommit<Impl>::skipCycles(Cycles cycles)
+{
+    // Nothing was committed in any of the skipped cycles.
+    numCommittedDist.sample(0, cycles);
+    cycleStats.skip(cycles);
+
+    // Commit polls the ROB head every cycle, so each skipped cycle
+    // reads it as often as the last tick did.
+    rob->robReads += (rob->robReads.value() - robReadsAtTick) * cycles;
+}
+
 template <class Impl>
 void
 DefaultCommit<Impl>::deactivateThread(ThreadID tid)
@@ -675,6 +693,8 @@ DefaultCommit<Impl>::tick()
 {
     wroteToTimeBuffer = false;
     _nextStatus = Inactive;
+    cycleStats.clear();
+    robReadsAtTick = rob->robReads.value();
 
     if (activeThreads->empty())
         return;
@@ -1214,7 +1234,7 @@ DefaultCommit<Impl>::commitHead(DynInstPtr &head_inst, unsigned inst_num)
             toIEW->commitInfo[tid].strictlyOrdered = true;
             toIEW->commitInfo[tid].strictlyOrderedLoad = head_inst;
         } else {
-            ++commitNonSpecStalls;
+            cycleStats.count(commitNonSpecStalls);
         }
 
         return false;
@@ -184,6 +184,9 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
       activityRec(name(), NumStages,
                   params->backComSize + params->forwardComSize,
                   params->activity),
+      idleSkip(params->idleSkip),
+      quiesced(false),
+      wakeRequested(false),
 
       globalSeqNum(1),
       system(params->system),
@@ -690,6 +693,18 @@ FullO3CPU<Impl>::regStats()
               "for an interrupt")
         .prereq(quiesceCycles);
 
+    timesSkipped
+        .name(name() + ".timesSkipped")
+        .desc("Number of times that the CPU unscheduled itself because no "
+              "stage could make progress before an external event")
+        .prereq(timesSkipped);
+
+    skippedCycles
+        .name(name() + ".skippedCycles")
+        .desc("Total number of cycles that the CPU has spent unscheduled "
+              "waiting for an external event")
+        .prereq(skippedCycles);
+
     // Number of Instructions simulated
     // --------------------------------
     // Should probably be in Base CPU but need templated
@@ -918,6 +933,8 @@ FullO3CPU<Impl>::tick()
     ++numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
+    quiesced = false;
+
 //    activity = false;
 
     //Tick each of the stages
@@ -939,6 +956,12 @@ FullO3CPU<Impl>::tick()
     renameQueue.advance();
     iewQueue.advance();
 
+    // Whether anything happened this cycle has to be sampled before the
+    // activity buffer moves on to the next cycle.
+    bool progress = activityRec.activeThisCycle() || wakeRequested ||
+        removeInstsThisCycle;
+    wakeRequested = false;
+
     activityRec.advance();
 
     if (removeInstsThisCycle) {
@@ -954,6 +977,11 @@ FullO3CPU<Impl>::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             timesIdled++;
+        } else if (idleSkip && isQuiescent(progress)) {
+            DPRINTF(O3CPU, "Quiescent, waiting for an external event!\n");
+            lastRunningCycle = curCycle();
+            quiesced = true;
+            timesSkipped++;
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -1539,6 +1567,7 @@ FullO3CPU<Impl>::drainResume()
     }
 
     assert(!tickEvent.scheduled());
+    quiesced = false;
     if (_status == Running)
         schedule(tickEvent, nextCycle());
 
@@ -1554,6 +1583,7 @@ FullO3CPU<Impl>::switchOut()
     BaseCPU::switchOut();
 
     activityRec.reset();
+    quiesced = false;
 
     _status = SwitchedOut;
 
@@ -2379,8 +2409,9 @@ template <class Impl>
 void
 FullO3CPU<Impl>::wakeCPU()
 {
-    if (activityRec.active() || tickEvent.scheduled()) {
+    if (tickEvent.scheduled() || (activityRec.active() && !quiesced)) {
         DPRINTF(Activity, "CPU already running.\n");
+        wakeRequested = true;
         return;
     }
 
@@ -2390,17 +2421,66 @@ FullO3CPU<Impl>::wakeCPU()
     // @todo: This is an oddity that is only here to match the stats
     if (cycles > 1) {
         --cycles;
-        idleCycles += cycles;
+        if (quiesced) {
+            skippedCycles += cycles;
+            skipCycles(cycles);
+        } else {
+            idleCycles += cycles;
+        }
         numCycles += cycles;
     }
 
-    schedule(tickEvent, clockEdge());
+    if (quiesced && cycles == 0) {
+        // The CPU already ticked this cycle, so the event is observed
+        // next cycle just as if the CPU had never been descheduled.
+        schedule(tickEvent, clockEdge(Cycles(1)));
+    } else {
+        schedule(tickEvent, clockEdge());
+    }
+    quiesced = false;
+}
+
+template <class Impl>
+bool
+FullO3CPU<Impl>::isQuiescent(bool progress)
+{
+    // Thread priorities rotate every cycle when more than one thread is
+    // active, so skipped cycles could not be replayed exactly.
+    if (progress || activeThreads.size() != 1 ||
+        activityRec.commInFlight() || drainState() == DrainState::Draining)
+        return false;
+
+    // Keep ticking while the LSQ has stores to send, loads to replay or
+    // is waiting on the dcache, as none of its state is replayed.
+    if (iew.ldstQueue.willWB() || iew.ldstQueue.isStalled() ||
+        iew.ldstQueue.isCacheBlocked())
+        return false;
+
+    return true;
+}
+
+template <class Impl>
+void
+FullO3CPU<Impl>::skipCycles(Cycles cycles)
+{
+    fetch.skipCycles(cycles);
+    decode.skipCycles(cycles);
+    rename.skipCycles(cycles);
+    iew.skipCycles(cycles);
+    commit.skipCycles(cycles);
 }
 
 template <class Impl>
 void
 FullO3CPU<Impl>::wakeup(ThreadID tid)
 {
+    // A quiesced CPU still has an active thread, but an interrupt has
+    // to be noticed all the same.
+    if (quiesced) {
+        this->wakeCPU();
+        return;
+    }
+
     if (this->thread[tid]->status() != ThreadContext::Suspended)
         return;
 
@@ -730,6 +730,34 @@ class FullO3CPU : public BaseO3CPU
      */
     ActivityRecorder activityRec;
 
+    /** Whether the CPU may deschedule itself while it is quiescent. */
+    const bool idleSkip;
+
+    /** Set when the CPU descheduled itself because it was quiescent,
+     * as opposed to the activity recorder running out of activity.
+     */
+    bool quiesced;
+
+    /** Set when wakeCPU() is called while the CPU is still running,
+     * meaning some event changed the CPU state this cycle.
+     */
+    bool wakeRequested;
+
+    /** Checks whether ticking the CPU again would leave its state
+     * unchanged. This is the case if no stage made progress this cycle,
+     * nothing is in flight in the time buffers and no thread switching
+     * or draining is pending, so only an external event (a memory
+     * response, a retry, a functional unit completion or a trap) can
+     * let the pipeline move forward.
+     * @param progress Whether any stage made progress this cycle.
+     */
+    bool isQuiescent(bool progress);
+
+    /** Accounts for cycles skipped while the CPU was quiescent in the
+     * per-cycle state of the stages.
+     */
+    void skipCycles(Cycles cycles);
+
   public:
     /** Records that there was time buffer activity this cycle. */
     void activityThisCycle() { activityRec.activity(); }
@@ -832,6 +860,12 @@ class FullO3CPU : public BaseO3CPU
     /** Stat for total number of cycles the CPU spends descheduled due to a
      * quiesce operation or waiting for an interrupt. */
     Stats::Scalar quiesceCycles;
+    /** Stat for total number of times the CPU is descheduled because it
+     * could not make progress before an external event. */
+    Stats::Scalar timesSkipped;
+    /** Stat for total number of cycles skipped while the CPU could not
+     * make progress before an external event. */
+    Stats::Scalar skippedCycles;
     /** Stat for the number of committed instructions per thread. */
     Stats::Vector committedInsts;
     /** Stat for the number of committed ops (including micro ops) per thread. */
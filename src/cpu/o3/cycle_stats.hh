@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_CYCLE_STATS_HH__
+#define __CPU_O3_CYCLE_STATS_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+
+/**
+ * Remembers the per-cycle counters (idle, blocked, stall cycles...) a
+ * pipeline stage incremented during its last tick. A CPU that skips
+ * quiescent cycles would have seen every stage increment the same
+ * counters in each of them, so they can be caught up in bulk.
+ */
+class CycleStats
+{
+  public:
+    /** Start recording a new cycle. */
+    void clear() { stats.clear(); }
+
+    /** Increment a per-cycle counter and remember it. */
+    void
+    count(Stats::Scalar &stat)
+    {
+        ++stat;
+        stats.push_back(&stat);
+    }
+
+    /** Account the recorded counters for cycles more cycles. */
+    void
+    skip(Cycles cycles) const
+    {
+        for (auto stat : stats)
+            *stat += cycles;
+    }
+
+  private:
+    std::vector<Stats::Scalar *> stats;
+};
+
+#endif // __CPU_O3_CYCLE_STATS_HH__
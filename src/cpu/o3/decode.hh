@@ -46,6 +46,7 @@
 #include <queue>
 
 #include "base/statistics.hh"
+#include "cpu/o3/cycle_stats.hh"
 #include "cpu/timebuf.hh"
 
 struct DerivO3CPUParams;
@@ -133,6 +134,9 @@ class DefaultDecode
     /** Takes over from another CPU's thread. */
     void takeOverFrom() { resetStage(); }
 
+    /** Accounts for cycles the CPU skipped while quiescent. */
+    void skipCycles(Cycles cycles) { cycleStats.skip(cycles); }
+
     /** Ticks decode, processing all input signals and decoding as many
      * instructions as possible.
      */
@@ -298,6 +302,9 @@ class DefaultDecode
     bool squashAfterDelaySlot[Impl::MaxThreads];
 
 
+    /** Per-cycle stats incremented in the last tick. */
+    CycleStats cycleStats;
+
     /** Stat for total number of idle cycles. */
     Stats::Scalar decodeIdleCycles;
     /** Stat for total number of blocked cycles. */
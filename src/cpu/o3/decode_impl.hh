@@ -631,6 +631,7 @@ void
 DefaultDecode<Impl>::tick()
 {
     wroteToTimeBuffer = false;
+    cycleStats.clear();
 
     bool status_change = false;
 
@@ -674,9 +675,9 @@ DefaultDecode<Impl>::decode(bool &status_change, ThreadID tid)
     //     check if stall conditions have passed
 
     if (decodeStatus[tid] == Blocked) {
-        ++decodeBlockedCycles;
+        cycleStats.count(decodeBlockedCycles);
     } else if (decodeStatus[tid] == Squashing) {
-        ++decodeSquashCycles;
+        cycleStats.count(decodeSquashCycles);
     }
 
     // Decode should try to decode as many instructions as its bandwidth
@@ -720,14 +721,14 @@ DefaultDecode<Impl>::decodeInsts(ThreadID tid)
         DPRINTF(Decode, "[tid:%u] Nothing to do, breaking out"
                 " early.\n",tid);
         // Should I change the status to idle?
-        ++decodeIdleCycles;
+        cycleStats.count(decodeIdleCycles);
         return;
     } else if (decodeStatus[tid] == Unblocking) {
         DPRINTF(Decode, "[tid:%u] Unblocking, removing insts from skid "
                 "buffer.\n",tid);
-        ++decodeUnblockCycles;
+        cycleStats.count(decodeUnblockCycles);
     } else if (decodeStatus[tid] == Running) {
-        ++decodeRunCycles;
+        cycleStats.count(decodeRunCycles);
     }
 
     DynInstPtr inst;
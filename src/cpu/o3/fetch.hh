@@ -48,6 +48,7 @@
 #include "arch/utility.hh"
 #include "base/statistics.hh"
 #include "config/the_isa.hh"
+#include "cpu/o3/cycle_stats.hh"
 #include "cpu/pc_event.hh"
 #include "cpu/pred/bpred_unit.hh"
 #include "cpu/pred/lvpt.hh"
@@ -244,6 +245,9 @@ class DefaultFetch
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Accounts for cycles the CPU skipped while quiescent. */
+    void skipCycles(Cycles cycles);
+
     /**
      * Stall the fetch stage after reaching a safe drain point.
      *
@@ -546,6 +550,9 @@ class DefaultFetch
     /** Event used to delay fault generation of translation faults */
     FinishTranslationEvent finishTranslationEvent;
 
+    /** Per-cycle stats incremented in the last tick. */
+    CycleStats cycleStats;
+
     // @todo: Consider making these vectors and tracking on a per thread basis.
     /** Stat for total number of cycles stalled due to an icache miss. */
     Stats::Scalar icacheStallCycles;
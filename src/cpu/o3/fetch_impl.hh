@@ -499,6 +499,20 @@ DefaultFetch<Impl>::takeOverFrom()
 
 }
 
+template <class Impl>
+void
+DefaultFetch<Impl>::skipCycles(Cycles cycles)
+{
+    // tick() draws a starting thread every cycle, so replay the draws to
+    // keep the random number stream identical to a run without skipping.
+    for (Cycles i(0); i < cycles; ++i) {
+        random_mt.random<uint8_t>(0, activeThreads->size() - 1);
+    }
+
+    fetchNisnDist.sample(0, cycles);
+    cycleStats.skip(cycles);
+}
+
 template <class Impl>
 void
 DefaultFetch<Impl>::drainStall(ThreadID tid)
@@ -653,7 +667,7 @@ DefaultFetch<Impl>::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
     // Setup the memReq to do a read of the first instruction's address.
     // Set the appropriate read size and flags as well.
     // Build request here.
-    RequestPtr mem_req = std::make_shared<Request>(
+    RequestPtr mem_req = makeRequest(
         tid, fetchBufferBlockPC, fetchBufferSize,
         Request::INST_FETCH, cpu->instMasterId(), pc,
         cpu->thread[tid]->contextId());
@@ -990,6 +1004,7 @@ DefaultFetch<Impl>::tick()
     bool status_change = false;
 
     wroteToTimeBuffer = false;
+    cycleStats.clear();
 
     for (ThreadID i = 0; i < numThreads; ++i) {
         issuePipelinedIfetch[i] = false;
@@ -1435,23 +1450,23 @@ DefaultFetch<Impl>::fetch(bool &status_change)
             fetchCacheLine(fetchAddr, tid, thisPC.instAddr());
 
             if (fetchStatus[tid] == IcacheWaitResponse)
-                ++icacheStallCycles;
+                cycleStats.count(icacheStallCycles);
             else if (fetchStatus[tid] == ItlbWait)
-                ++fetchTlbCycles;
+                cycleStats.count(fetchTlbCycles);
             else
-                ++fetchMiscStallCycles;
+                cycleStats.count(fetchMiscStallCycles);
             return;
         } else if ((checkInterrupt(thisPC.instAddr()) && !delayedCommit[tid])) {
             // Stall CPU if an interrupt is posted and we're not issuing
             // an delayed commit micro-op currently (delayed commit instructions
             // are not interruptable by interrupts, only faults)
-            ++fetchMiscStallCycles;
+            cycleStats.count(fetchMiscStallCycles);
             DPRINTF(Fetch, "[tid:%i]: Fetch is stalled!\n", tid);
             return;
         }
     } else {
         if (fetchStatus[tid] == Idle) {
-            ++fetchIdleCycles;
+            cycleStats.count(fetchIdleCycles);
             DPRINTF(Fetch, "[tid:%i]: Fetch is idle!\n", tid);
         }
 
@@ -1459,7 +1474,7 @@ DefaultFetch<Impl>::fetch(bool &status_change)
         return;
     }
 
-    ++fetchCycles;
+    cycleStats.count(fetchCycles);
 
     TheISA::PCState nextPC = thisPC;
 
@@ -1987,35 +2002,35 @@ DefaultFetch<Impl>::profileStall(ThreadID tid) {
     // @todo Per-thread stats
 
     if (stalls[tid].drain) {
-        ++fetchPendingDrainCycles;
+        cycleStats.count(fetchPendingDrainCycles);
         DPRINTF(Fetch, "Fetch is waiting for a drain!\n");
     } else if (activeThreads->empty()) {
-        ++fetchNoActiveThreadStallCycles;
+        cycleStats.count(fetchNoActiveThreadStallCycles);
         DPRINTF(Fetch, "Fetch has no active thread!\n");
     } else if (fetchStatus[tid] == Blocked) {
-        ++fetchBlockedCycles;
+        cycleStats.count(fetchBlockedCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is blocked!\n", tid);
     } else if (fetchStatus[tid] == Squashing) {
-        ++fetchSquashCycles;
+        cycleStats.count(fetchSquashCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is squashing!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitResponse) {
-        ++icacheStallCycles;
+        cycleStats.count(icacheStallCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is waiting cache response!\n",
                 tid);
     } else if (fetchStatus[tid] == ItlbWait) {
-        ++fetchTlbCycles;
+        cycleStats.count(fetchTlbCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is waiting ITLB walk to "
                 "finish!\n", tid);
     } else if (fetchStatus[tid] == TrapPending) {
-        ++fetchPendingTrapStallCycles;
+        cycleStats.count(fetchPendingTrapStallCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is waiting for a pending trap!\n",
                 tid);
     } else if (fetchStatus[tid] == QuiescePending) {
-        ++fetchPendingQuiesceStallCycles;
+        cycleStats.count(fetchPendingQuiesceStallCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is waiting for a pending quiesce "
                 "instruction!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitRetry) {
-        ++fetchIcacheWaitRetryStallCycles;
+        cycleStats.count(fetchIcacheWaitRetryStallCycles);
         DPRINTF(Fetch, "[tid:%i]: Fetch is waiting for an I-cache retry!\n",
                 tid);
     } else if (fetchStatus[tid] == NoGoodAddr) {
@@ -48,6 +48,7 @@
 
 #include "base/statistics.hh"
 #include "cpu/o3/comm.hh"
+#include "cpu/o3/cycle_stats.hh"
 #include "cpu/o3/lsq.hh"
 #include "cpu/o3/scoreboard.hh"
 #include "cpu/simple/WordFM.hh"
@@ -174,6 +175,9 @@ class DefaultIEW
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Accounts for cycles the CPU skipped while quiescent. */
+    void skipCycles(Cycles cycles);
+
     /** Squashes instructions in IEW for a specific thread. */
     void squash(ThreadID tid);
 
@@ -428,6 +432,9 @@ class DefaultIEW
     /** Maximum size of the skid buffer. */
     unsigned skidBufferMax;
 
+    /** Per-cycle stats incremented in the last tick. */
+    CycleStats cycleStats;
+
     /** Stat for total number of idle cycles. */
     Stats::Scalar iewIdleCycles;
     /** Stat for total number of squashing cycles. */
@@ -461,6 +461,14 @@ DefaultIEW<Impl>::takeOverFrom()
     }
 }
 
+template <class Impl>
+void
+DefaultIEW<Impl>::skipCycles(Cycles cycles)
+{
+    cycleStats.skip(cycles);
+    instQueue.skipCycles(cycles);
+}
+
 template<class Impl>
 void
 DefaultIEW<Impl>::squash(ThreadID tid)
@@ -1075,10 +1083,10 @@ DefaultIEW<Impl>::dispatch(ThreadID tid)
     //     check if stall conditions have passed
 
     if (dispatchStatus[tid] == Blocked) {
-        ++iewBlockCycles;
+        cycleStats.count(iewBlockCycles);
 
     } else if (dispatchStatus[tid] == Squashing) {
-        ++iewSquashCycles;
+        cycleStats.count(iewSquashCycles);
     }
 
     // Dispatch should try to dispatch as many instructions as its bandwidth
@@ -1099,7 +1107,7 @@ DefaultIEW<Impl>::dispatch(ThreadID tid)
         // the rest of unblocking.
         dispatchInsts(tid);
 
-        ++iewUnblockCycles;
+        cycleStats.count(iewUnblockCycles);
 
         if (validInstsFromRename()) {
             // Add the current inputs to the skid buffer so they can be
@@ -1191,7 +1199,7 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
             // get full in the IQ.
             toRename->iewUnblock[tid] = false;
 
-            ++iewIQFullEvents;
+            cycleStats.count(iewIQFullEvents);
             break;
         }
 
@@ -1209,7 +1217,7 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
             // get full in the IQ.
             toRename->iewUnblock[tid] = false;
 
-            ++iewLSQFullEvents;
+            cycleStats.count(iewLSQFullEvents);
             break;
         }
 
@@ -1736,6 +1744,7 @@ DefaultIEW<Impl>::tick()
 
     wroteToTimeBuffer = false;
     updatedQueues = false;
+    cycleStats.clear();
 
     sortInsts();
     // Free function units marked as being freed this cycle.
@@ -55,6 +55,7 @@
 #include "cpu/inst_seq.hh"
 #include "cpu/op_class.hh"
 #include "cpu/timebuf.hh"
+#include "sim/event_pool.hh"
 #include "sim/eventq.hh"
 
 struct DerivO3CPUParams;
@@ -95,8 +96,8 @@ class InstructionQueue
     // Typedef of iterator through the list of instructions.
     typedef typename std::list<DynInstPtr>::iterator ListIt;
 
-    /** FU completion event class. */
-    class FUCompletion : public Event {
+    /** FU completion event class, allocated from a per-thread pool. */
+    class FUCompletion : public Event, public EventPool<FUCompletion> {
       private:
         /** Executing instruction. */
         DynInstPtr inst;
@@ -155,6 +156,9 @@ class InstructionQueue
     /** Takes over execution from another CPU's thread. */
     void takeOverFrom();
 
+    /** Accounts for cycles the CPU skipped while quiescent. */
+    void skipCycles(Cycles cycles);
+
     /** Number of entries needed for given amount of threads. */
     int entryAmount(ThreadID num_threads);
 
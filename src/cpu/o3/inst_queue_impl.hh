@@ -496,6 +496,14 @@ InstructionQueue<Impl>::takeOverFrom()
     resetState();
 }
 
+template <class Impl>
+void
+InstructionQueue<Impl>::skipCycles(Cycles cycles)
+{
+    // Nothing was issued in any of the skipped cycles.
+    numIssuedDist.sample(0, cycles);
+}
+
 template <class Impl>
 int
 InstructionQueue<Impl>::entryAmount(ThreadID num_threads)
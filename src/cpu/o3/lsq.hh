@@ -280,6 +280,14 @@ class LSQ {
     bool willWB(ThreadID tid)
     { return thread[tid].willWB(); }
 
+    /** Returns if the LSQ is waiting for the dcache to accept a retry. */
+    bool isCacheBlocked();
+    /** Returns if the LSQ of a specific thread is waiting for the dcache to
+     * accept a retry.
+     */
+    bool isCacheBlocked(ThreadID tid)
+    { return thread[tid].isCacheBlocked(); }
+
     /** Debugging function to print out all instructions. */
     void dumpInsts() const;
     /** Debugging function to print out instructions from a specific thread. */
@@ -714,6 +714,23 @@ LSQ<Impl>::willWB()
     return false;
 }
 
+template<class Impl>
+bool
+LSQ<Impl>::isCacheBlocked()
+{
+    list<ThreadID>::iterator threads = activeThreads->begin();
+    list<ThreadID>::iterator end = activeThreads->end();
+
+    while (threads != end) {
+        ThreadID tid = *threads++;
+
+        if (isCacheBlocked(tid))
+            return true;
+    }
+
+    return false;
+}
+
 template<class Impl>
 void
 LSQ<Impl>::dumpInsts() const
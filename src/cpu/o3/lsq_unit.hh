@@ -61,6 +61,7 @@
 #include "debug/LSQUnit.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
+#include "sim/event_pool.hh"
 #include "debug/Capability.hh"
 
 struct DerivO3CPUParams;
@@ -250,6 +251,9 @@ class LSQUnit {
                         !storeQueue[storeWBIdx].completed &&
                         !isStoreBlocked; }
 
+    /** Returns if a store is waiting for the dcache to accept a retry. */
+    bool isCacheBlocked() { return isStoreBlocked || hasPendingPkt; }
+
     /** Handles doing the retry. */
     void recvRetry();
 
@@ -334,8 +338,10 @@ class LSQUnit {
         inline bool complete() { return --outstanding == 0; }
     };
 
-    /** Writeback event, specifically for when stores forward data to loads. */
-    class WritebackEvent : public Event {
+    /** Writeback event, specifically for when stores forward data to loads.
+     * Allocated from a per-thread pool.
+     */
+    class WritebackEvent : public Event, public EventPool<WritebackEvent> {
       public:
         /** Constructs a writeback event. */
         WritebackEvent(DynInstPtr &_inst, PacketPtr pkt, LSQUnit *lsq_ptr);
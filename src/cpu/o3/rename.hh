@@ -49,6 +49,7 @@
 
 #include "base/statistics.hh"
 #include "config/the_isa.hh"
+#include "cpu/o3/cycle_stats.hh"
 #include "cpu/timebuf.hh"
 #include "sim/probe/probe.hh"
 
@@ -190,6 +191,9 @@ class DefaultRename
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
+    /** Accounts for cycles the CPU skipped while quiescent. */
+    void skipCycles(Cycles cycles) { cycleStats.skip(cycles); }
+
     /** Squashes all instructions in a thread. */
     void squash(const InstSeqNum &squash_seq_num, ThreadID tid);
 
@@ -482,6 +486,9 @@ class DefaultRename
      */
     inline void incrFullStat(const FullSource &source);
 
+    /** Per-cycle stats incremented in the last tick. */
+    CycleStats cycleStats;
+
     /** Stat for total number of cycles spent squashing. */
     Stats::Scalar renameSquashCycles;
     /** Stat for total number of cycles spent idle. */
@@ -443,6 +443,7 @@ void
 DefaultRename<Impl>::tick()
 {
     wroteToTimeBuffer = false;
+    cycleStats.clear();
 
     blockThisCycle = false;
 
@@ -514,11 +515,11 @@ DefaultRename<Impl>::rename(bool &status_change, ThreadID tid)
     //     check if stall conditions have passed
 
     if (renameStatus[tid] == Blocked) {
-        ++renameBlockCycles;
+        cycleStats.count(renameBlockCycles);
     } else if (renameStatus[tid] == Squashing) {
-        ++renameSquashCycles;
+        cycleStats.count(renameSquashCycles);
     } else if (renameStatus[tid] == SerializeStall) {
-        ++renameSerializeStallCycles;
+        cycleStats.count(renameSerializeStallCycles);
         // If we are currently in SerializeStall and resumeSerialize
         // was set, then that means that we are resuming serializing
         // this cycle.  Tell the previous stages to block.
@@ -571,12 +572,12 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
         DPRINTF(Rename, "[tid:%u]: Nothing to do, breaking out early.\n",
                 tid);
         // Should I change status to idle?
-        ++renameIdleCycles;
+        cycleStats.count(renameIdleCycles);
         return;
     } else if (renameStatus[tid] == Unblocking) {
-        ++renameUnblockCycles;
+        cycleStats.count(renameUnblockCycles);
     } else if (renameStatus[tid] == Running) {
-        ++renameRunCycles;
+        cycleStats.count(renameRunCycles);
     }
 
     DynInstPtr inst;
@@ -709,7 +710,7 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
                     "physical registers to rename to.\n");
             blockThisCycle = true;
             insts_to_rename.push_front(inst);
-            ++renameFullRegistersEvents;
+            cycleStats.count(renameFullRegistersEvents);
 
             break;
         }
@@ -1440,16 +1441,16 @@ DefaultRename<Impl>::incrFullStat(const FullSource &source)
 {
     switch (source) {
       case ROB:
-        ++renameROBFullEvents;
+        cycleStats.count(renameROBFullEvents);
         break;
       case IQ:
-        ++renameIQFullEvents;
+        cycleStats.count(renameIQFullEvents);
         break;
       case LQ:
-        ++renameLQFullEvents;
+        cycleStats.count(renameLQFullEvents);
         break;
       case SQ:
-        ++renameSQFullEvents;
+        cycleStats.count(renameSQFullEvents);
         break;
       default:
         panic("Rename full stall stat should be incremented for a reason!");
@@ -61,8 +61,15 @@ class AtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    use_backdoor = Param.Bool(False, "Access memory through backdoors "
+                              "granted on the atomic path (such accesses "
+                              "are not seen by the memory statistics)")
+    block_cache = Param.Bool(False, "Cache decoded basic blocks and run "
+                             "them without fetching (instructions run "
+                             "from the cache don't access the icache)")
 
-    def addSimPointProbe(self, interval):
+    def addSimPointProbe(self, interval, max_k=0):
         simpoint = SimPoint()
         simpoint.interval = interval
+        simpoint.max_k = max_k
         self.probeListener = simpoint
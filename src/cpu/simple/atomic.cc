@@ -85,13 +85,24 @@ AtomicSimpleCPU::AtomicSimpleCPU(AtomicSimpleCPUParams *p)
       simulate_inst_stalls(p->simulate_inst_stalls),
       icachePort(name() + ".icache_port", this),
       dcachePort(name() + ".dcache_port", this),
+      useBackdoor(p->use_backdoor && numThreads == 1),
       dcache_access(false), dcache_latency(0),
       ppCommit(nullptr)
 {
     _status = Idle;
-    ifetch_req = std::make_shared<Request>();
-    data_read_req = std::make_shared<Request>();
-    data_write_req = std::make_shared<Request>();
+    ifetch_req = makeRequest();
+    data_read_req = makeRequest();
+    data_write_req = makeRequest();
+
+    // instructions run from the block cache are not fetched, which
+    // would make icache stalls disappear
+    if (p->block_cache && simulate_inst_stalls) {
+        warn("%s: Not caching decoded blocks as icache stalls are "
+             "simulated.\n", name());
+    } else if (p->block_cache) {
+        for (ThreadID tid = 0; tid < numThreads; tid++)
+            blockCaches.emplace_back(new DecodedBlockCache(MaxBlockInsts));
+    }
 
 
     numOfMemRefs = 0;
@@ -341,6 +352,14 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    // the memory mode may have changed while we were drained, and
+    // with it the paths that are allowed to hand out backdoors
+    icachePort.flushBackdoors();
+    dcachePort.flushBackdoors();
+
+    // memory may have been changed behind our back while drained
+    flushBlockCaches();
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -399,6 +418,10 @@ AtomicSimpleCPU::takeOverFrom(BaseCPU *oldCPU)
 
     // The tick event should have been descheduled by drain()
     assert(!tickEvent.scheduled());
+
+    icachePort.flushBackdoors();
+    dcachePort.flushBackdoors();
+    flushBlockCaches();
 }
 
 void
@@ -465,7 +488,60 @@ AtomicSimpleCPU::suspendContext(ThreadID thread_num)
 Tick
 AtomicSimpleCPU::sendPacket(MasterPort &port, const PacketPtr &pkt)
 {
-    return port.sendAtomic(pkt);
+    if (!backdoorAllowed(pkt->req))
+        return port.sendAtomic(pkt);
+
+    AtomicCPUPort &cpu_port = &port == &icachePort ? icachePort : dcachePort;
+    assert(&port == &cpu_port);
+
+    MemBackdoor backdoor;
+    Tick latency = port.sendAtomicBackdoor(pkt, backdoor);
+    if (backdoor.valid())
+        cpu_port.insertBackdoor(pkt->getAddr(), backdoor);
+    return latency;
+}
+
+void
+AtomicSimpleCPU::AtomicCPUPort::insertBackdoor(Addr paddr,
+                                               const MemBackdoor &backdoor)
+{
+    Addr page_addr = paddr & ~BackdoorPageMask;
+    if (!backdoor.range().contains(page_addr) ||
+        !backdoor.range().contains(page_addr + BackdoorPageMask)) {
+        return;
+    }
+
+    DPRINTF(SimpleCPU, "%s: backdoor for page %#x from %s\n", name(),
+            page_addr, backdoor.range().to_string());
+
+    BackdoorPage &entry = backdoorPages[(paddr >> BackdoorPageShift) %
+                                        NumBackdoorPages];
+    entry.page = paddr >> BackdoorPageShift;
+    entry.ptr = backdoor.hostAddr(page_addr);
+    entry.latency = backdoor.latency();
+    entry.flags = backdoor.flags();
+}
+
+void
+AtomicSimpleCPU::AtomicCPUPort::flushBackdoors()
+{
+    for (auto &entry : backdoorPages)
+        entry.page = MaxAddr;
+}
+
+void
+AtomicSimpleCPU::AtomicCPUPort::recvBackdoorInvalidate(const AddrRange &range)
+{
+    DPRINTF(SimpleCPU, "%s: revoking backdoors to %s\n", name(),
+            range.to_string());
+
+    for (auto &entry : backdoorPages) {
+        if (entry.page != MaxAddr &&
+            range.intersects(RangeSize(entry.page << BackdoorPageShift,
+                                       BackdoorPageMask + 1))) {
+            entry.page = MaxAddr;
+        }
+    }
 }
 
 Tick
@@ -493,6 +569,9 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
         for (auto &t_info : cpu->threadInfo) {
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
+
+        if (!cpu->blockCaches.empty())
+            cpu->invalidateCode(pkt->getAddr());
     }
 
     return 0;
@@ -520,6 +599,40 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
     }
+
+    if ((pkt->isInvalidate() || pkt->isWrite()) && !cpu->blockCaches.empty())
+        cpu->invalidateCode(pkt->getAddr());
+}
+
+void
+AtomicSimpleCPU::invalidateCode(Addr paddr)
+{
+    for (auto &block_cache : blockCaches) {
+        if (block_cache->isCodePage(paddr)) {
+            DPRINTF(SimpleCPU, "Dropping decoded blocks in page of %#x\n",
+                    paddr);
+            block_cache->invalidatePage(paddr);
+        }
+    }
+}
+
+void
+AtomicSimpleCPU::flushBlockCaches()
+{
+    for (auto &block_cache : blockCaches)
+        block_cache->clear();
+}
+
+const TheISA::TyCHEAllocationPoint *
+AtomicSimpleCPU::findAllocationPoint(Addr pc) const
+{
+    if (!threadContexts[0]->enableCapability)
+        return nullptr;
+
+    auto syms_it = threadContexts[0]->syms_cache.find(pc);
+    if (syms_it == threadContexts[0]->syms_cache.end())
+        return nullptr;
+    return &syms_it->second;
 }
 
 Fault
@@ -559,18 +672,23 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t * data, unsigned size,
 
         // Now do the access.
         if (fault == NoFault && !req->getFlags().isSet(Request::NO_ACCESS)) {
-            Packet pkt(req, Packet::makeReadCmd(req));
-            pkt.dataStatic(data);
+            if (!backdoorAllowed(req) ||
+                !dcachePort.accessBackdoor(req->getPaddr(), data, size,
+                                           false, dcache_latency)) {
+                Packet pkt(req, Packet::makeReadCmd(req));
+                pkt.dataStatic(data);
 
-            if (req->isMmappedIpr()) {
-                dcache_latency += TheISA::handleIprRead(thread->getTC(), &pkt);
-            } else {
-                dcache_latency += sendPacket(dcachePort, &pkt);
+                if (req->isMmappedIpr()) {
+                    dcache_latency +=
+                        TheISA::handleIprRead(thread->getTC(), &pkt);
+                } else {
+                    dcache_latency += sendPacket(dcachePort, &pkt);
+                }
+
+                assert(!pkt.isError());
             }
             dcache_access = true;
 
-            assert(!pkt.isError());
-
             if (req->isLLSC()) {
                 TheISA::handleLockedRead(thread, req);
             }
@@ -672,25 +790,32 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
             }
 
             if (do_access && !req->getFlags().isSet(Request::NO_ACCESS)) {
-                Packet pkt(req, Packet::makeWriteCmd(req));
-                pkt.dataStatic(data);
-
-                if (req->isMmappedIpr()) {
-                    dcache_latency +=
-                        TheISA::handleIprWrite(thread->getTC(), &pkt);
-                } else {
-                    dcache_latency += sendPacket(dcachePort, &pkt);
+                if (!backdoorAllowed(req) ||
+                    !dcachePort.accessBackdoor(req->getPaddr(), data, size,
+                                               true, dcache_latency)) {
+                    Packet pkt(req, Packet::makeWriteCmd(req));
+                    pkt.dataStatic(data);
+
+                    if (req->isMmappedIpr()) {
+                        dcache_latency +=
+                            TheISA::handleIprWrite(thread->getTC(), &pkt);
+                    } else {
+                        dcache_latency += sendPacket(dcachePort, &pkt);
+
+                        // Notify other threads on this CPU of write
+                        threadSnoop(&pkt, curThread);
+                    }
+                    assert(!pkt.isError());
 
-                    // Notify other threads on this CPU of write
-                    threadSnoop(&pkt, curThread);
+                    if (req->isSwap()) {
+                        assert(res);
+                        memcpy(res, pkt.getConstPtr<uint8_t>(), fullSize);
+                    }
                 }
                 dcache_access = true;
-                assert(!pkt.isError());
 
-                if (req->isSwap()) {
-                    assert(res);
-                    memcpy(res, pkt.getConstPtr<uint8_t>(), fullSize);
-                }
+                if (!blockCaches.empty())
+                    invalidateCode(req->getPaddr());
             }
 
             if (res && !req->isSwap()) {
@@ -750,10 +875,26 @@ AtomicSimpleCPU::tick()
 
     SimpleExecContext& t_info = *threadInfo[curThread];
     SimpleThread* thread = t_info.thread;
+    DecodedBlockCache *block_cache =
+        blockCaches.empty() ? nullptr : blockCaches[curThread].get();
 
     Tick latency = 0;
 
-    for (int i = 0; i < width || locked; ++i) {
+    // A cached block is run to its end within one tick. Its microops
+    // beyond the width of the CPU are accounted for as the cycles
+    // they would have taken in ticks of their own.
+    Tick block_latency = 0;
+    int cycle_insts = 0;
+    bool in_block = false;
+
+    for (int i = 0; i < width || locked || in_block; ++i) {
+        if (cycle_insts >= width && !locked) {
+            block_latency += std::max(latency, clockPeriod());
+            latency = 0;
+            cycle_insts = 0;
+        }
+        ++cycle_insts;
+
         numCycles++;
         updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -774,11 +915,33 @@ AtomicSimpleCPU::tick()
 
         bool needToFetch = !isRomMicroPC(pcState.microPC()) &&
                            !curMacroStaticInst;
-        if (needToFetch) {
+
+        // the next instruction of the block being run needs neither a
+        // translation nor a fetch
+        const DecodedBlockCache::Inst *cached = nullptr;
+        if (needToFetch && block_cache)
+            cached = block_cache->next(pcState,
+                                       thread->decoder.decodeContext());
+
+        if (needToFetch && !cached) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
             fault = thread->itb->translateAtomic(ifetch_req, thread->getTC(),
                                                  BaseTLB::Execute);
+
+            if (block_cache && fault == NoFault && t_info.fetchOffset == 0) {
+                Addr inst_paddr = ifetch_req->getPaddr() +
+                    (pcState.instAddr() - ifetch_req->getVaddr());
+                block_cache->fetchAddr(inst_paddr);
+
+                // only start a block in the cycles of this tick
+                if ((i < width || locked) &&
+                    block_cache->enter(inst_paddr, pcState.instAddr(),
+                                       thread->decoder.decodeContext())) {
+                    cached = block_cache->next(
+                        pcState, thread->decoder.decodeContext());
+                }
+            }
         }
 
         if (fault == NoFault) {
@@ -786,7 +949,7 @@ AtomicSimpleCPU::tick()
             bool icache_access = false;
             dcache_access = false; // assume no dcache access
 
-            if (needToFetch) {
+            if (needToFetch && !cached) {
                 // This is commented out because the decoder would act like
                 // a tiny cache otherwise. It wouldn't be flushed when needed
                 // like the I cache. It should be flushed, and when that works
@@ -795,24 +958,53 @@ AtomicSimpleCPU::tick()
                 //if (decoder.needMoreBytes())
                 //{
                     icache_access = true;
-                    Packet ifetch_pkt = Packet(ifetch_req, MemCmd::ReadReq);
-                    ifetch_pkt.dataStatic(&inst);
+                    if (!backdoorAllowed(ifetch_req) ||
+                        !icachePort.accessBackdoor(
+                            ifetch_req->getPaddr(), (uint8_t *)&inst,
+                            ifetch_req->getSize(), false, icache_latency)) {
+                        Packet ifetch_pkt = Packet(ifetch_req,
+                                                   MemCmd::ReadReq);
+                        ifetch_pkt.dataStatic(&inst);
 
-                    icache_latency = sendPacket(icachePort, &ifetch_pkt);
+                        icache_latency = sendPacket(icachePort, &ifetch_pkt);
 
-                    assert(!ifetch_pkt.isError());
+                        assert(!ifetch_pkt.isError());
+                    }
 
                     // ifetch_req is initialized to read the instruction directly
                     // into the CPU object's inst field.
                 //}
             }
 
-            preExecute();
+            // TyCHE allocation point of the instruction, if known
+            // from the block it comes from
+            const TheISA::TyCHEAllocationPoint *sym = nullptr;
+
+            if (cached) {
+                sym = cached->sym;
+                preExecute(cached->staticInst, cached->pc);
+            } else {
+                preExecute();
+
+                if (block_cache && needToFetch && !t_info.stayAtPC)
+                    recordInst();
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
                 fault = curStaticInst->execute(&t_info, traceData);
 
+                if (block_cache && !cached &&
+                    (fault != NoFault || endsBlock(curStaticInst) ||
+                     isRomMicroPC(pcState.microPC()))) {
+                    block_cache->endBlock();
+                }
+
+                // SE mode system calls write to memory through the
+                // functional path, which isn't snooped
+                if (!FullSystem && curStaticInst->isSyscall())
+                    flushBlockCaches();
+
                 SimpleExecContext& t_info = *threadInfo[0];
                 SimpleThread* thread = t_info.thread;
 
@@ -822,11 +1014,10 @@ AtomicSimpleCPU::tick()
               {
                   if (curStaticInst->isFirstMicroop())
                   {
-
-                    auto syms_it =
-                      (threadContexts[0]->syms_cache).find(pcState.instAddr());
-                    if (syms_it != (threadContexts[0]->syms_cache).end()){
-                      collector(threadContexts[0], pcState, syms_it->second);
+                    if (!cached)
+                      sym = findAllocationPoint(pcState.instAddr());
+                    if (sym) {
+                      collector(threadContexts[0], pcState, *sym);
                     }
                   }
               }
@@ -882,8 +1073,13 @@ AtomicSimpleCPU::tick()
             }
 
         }
+        if (fault != NoFault && block_cache)
+            block_cache->leaveBlock();
+
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
+
+        in_block = block_cache && block_cache->inBlock();
     }
 
     if (tryCompleteDrain())
@@ -892,11 +1088,40 @@ AtomicSimpleCPU::tick()
     // instruction takes at least one cycle
     if (latency < clockPeriod())
         latency = clockPeriod();
+    latency += block_latency;
 
     if (_status != Idle)
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+void
+AtomicSimpleCPU::recordInst()
+{
+    DecodedBlockCache &block_cache = *blockCaches[curThread];
+    SimpleThread *thread = threadInfo[curThread]->thread;
+    const TheISA::PCState &pc = thread->pcState();
+
+    // instructions crossing a page would need both pages to be
+    // checked for writes
+    if (roundDown(pc.instAddr(), TheISA::PageBytes) !=
+        roundDown(pc.nextInstAddr() - 1, TheISA::PageBytes)) {
+        block_cache.endBlock();
+        return;
+    }
+
+    block_cache.record(curMacroStaticInst ? curMacroStaticInst :
+                       curStaticInst, pc, thread->decoder.decodeContext(),
+                       findAllocationPoint(pc.instAddr()));
+}
+
+bool
+AtomicSimpleCPU::endsBlock(const StaticInstPtr &inst)
+{
+    return inst->isControl() || inst->isSerializing() ||
+        inst->isSquashAfter() || inst->isNonSpeculative() ||
+        inst->isQuiesce() || inst->isIprAccess() || inst->isSyscall();
+}
+
 void
 AtomicSimpleCPU::regProbePoints()
 {
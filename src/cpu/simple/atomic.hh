@@ -42,10 +42,13 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <array>
+#include <cstring>
 #include <fstream>
 
 #include "cpu/simple/WordFM.hh"
 #include "cpu/simple/base.hh"
+#include "cpu/simple/block_cache.hh"
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
 #include "params/AtomicSimpleCPU.hh"
@@ -175,10 +178,76 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
         AtomicCPUPort(const std::string &_name, BaseSimpleCPU* _cpu)
             : MasterPort(_name, _cpu)
-        { }
+        {
+            flushBackdoors();
+        }
+
+        /**
+         * Remember a backdoor granted for an access to the given
+         * physical address, by caching the page it falls in.
+         */
+        void insertBackdoor(Addr paddr, const MemBackdoor &backdoor);
+
+        /**
+         * Access memory through a cached backdoor, if there is one
+         * for the page with the required permission.
+         *
+         * @param paddr Physical address, not crossing a page
+         * @param data Data to read into or write from
+         * @param size Size of the access
+         * @param write True for writes
+         * @param latency Incremented with the backdoor latency on a hit
+         * @return true if the access was done
+         */
+        bool
+        accessBackdoor(Addr paddr, uint8_t *data, unsigned size,
+                       bool write, Tick &latency)
+        {
+            const BackdoorPage &entry =
+                backdoorPages[(paddr >> BackdoorPageShift) %
+                              NumBackdoorPages];
+            if (entry.page != (paddr >> BackdoorPageShift) ||
+                !(entry.flags & (write ? MemBackdoor::Writeable :
+                                 MemBackdoor::Readable))) {
+                return false;
+            }
+
+            uint8_t *host_addr = entry.ptr + (paddr & BackdoorPageMask);
+            if (write)
+                std::memcpy(host_addr, data, size);
+            else
+                std::memcpy(data, host_addr, size);
+            latency += entry.latency;
+            return true;
+        }
+
+        /** Drop all cached backdoors. */
+        void flushBackdoors();
 
       protected:
 
+        /** A page worth of a backdoor grant. */
+        struct BackdoorPage
+        {
+            /** Page number, MaxAddr if the entry is unused */
+            Addr page;
+            /** Host pointer for the start of the page */
+            uint8_t *ptr;
+            Tick latency;
+            MemBackdoor::Flags flags;
+        };
+
+        static const unsigned BackdoorPageShift = 12;
+        static const Addr BackdoorPageMask = (1 << BackdoorPageShift) - 1;
+        static const unsigned NumBackdoorPages = 64;
+
+        /** Direct-mapped cache of grants, indexed by page number. */
+        std::array<BackdoorPage, NumBackdoorPages> backdoorPages;
+
+        void recvBackdoorInvalidate(const AddrRange &range) override;
+
+        void recvRangeChange() override { flushBackdoors(); }
+
         bool recvTimingResp(PacketPtr pkt)
         {
             panic("Atomic CPU doesn't expect recvTimingResp!\n");
@@ -221,9 +290,56 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     RequestPtr data_read_req;
     RequestPtr data_write_req;
 
+    /** Ask for and use memory backdoors on the atomic path */
+    const bool useBackdoor;
+
+    /**
+     * Check if an access may go through a backdoor. Anything with
+     * side effects beyond reading or writing the data, or that other
+     * objects need to observe, always uses packets.
+     */
+    bool
+    backdoorAllowed(const RequestPtr &req) const
+    {
+        const Request::FlagsType exclude =
+            Request::UNCACHEABLE | Request::STRICT_ORDER |
+            Request::MMAPPED_IPR | Request::GENERIC_IPR |
+            Request::CACHE_BLOCK_ZERO | Request::NO_ACCESS |
+            Request::LOCKED_RMW | Request::LLSC | Request::MEM_SWAP |
+            Request::MEM_SWAP_COND | Request::PREFETCH |
+            Request::PF_EXCLUSIVE | Request::EVICT_NEXT |
+            Request::ACQUIRE | Request::RELEASE |
+            Request::ATOMIC_RETURN_OP | Request::ATOMIC_NO_RETURN_OP |
+            Request::SECURE | Request::INVALIDATE | Request::CLEAN;
+        return useBackdoor && !req->getFlags().isSet(exclude);
+    }
+
     bool dcache_access;
     Tick dcache_latency;
 
+    /** Maximum number of instructions in a decoded block */
+    static const unsigned MaxBlockInsts = 64;
+
+    /** Decoded blocks per thread, empty if not caching blocks */
+    std::vector<std::unique_ptr<DecodedBlockCache>> blockCaches;
+
+    /**
+     * Add the instruction just decoded by the current thread to the
+     * block it is building.
+     */
+    void recordInst();
+
+    /** Check if a microop may end the straight-line run of its block. */
+    static bool endsBlock(const StaticInstPtr &inst);
+
+    /** Drop the decoded blocks in the page of a physical address. */
+    void invalidateCode(Addr paddr);
+
+    void flushBlockCaches();
+
+    /** Look up the TyCHE allocation point at a PC, if enabled. */
+    const TheISA::TyCHEAllocationPoint *findAllocationPoint(Addr pc) const;
+
     /** Probe Points. */
     ProbePointArg<std::pair<SimpleThread*, const StaticInstPtr>> *ppCommit;
 
@@ -485,7 +485,7 @@ BaseSimpleCPU::setupFetchRequest(const RequestPtr &req)
 
 
 void
-BaseSimpleCPU::preExecute()
+BaseSimpleCPU::preDecode()
 {
     SimpleExecContext &t_info = *threadInfo[curThread];
     SimpleThread* thread = t_info.thread;
@@ -499,6 +499,15 @@ BaseSimpleCPU::preExecute()
     // check for instruction-count-based events
     comInstEventQueue[curThread]->serviceEvents(t_info.numInst);
     system->instEventQueue.serviceEvents(system->totalNumInsts);
+}
+
+void
+BaseSimpleCPU::preExecute()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
+    preDecode();
 
     // decode the instruction
     inst = gtoh(inst);
@@ -557,6 +566,38 @@ BaseSimpleCPU::preExecute()
         curStaticInst = curMacroStaticInst->fetchMicroop(pcState.microPC());
     }
 
+    postDecode();
+}
+
+void
+BaseSimpleCPU::preExecute(const StaticInstPtr &inst,
+                          const TheISA::PCState &pc)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
+    preDecode();
+
+    assert(!curMacroStaticInst);
+    t_info.stayAtPC = false;
+    thread->pcState(pc);
+
+    if (inst->isMacroop()) {
+        curMacroStaticInst = inst;
+        curStaticInst = curMacroStaticInst->fetchMicroop(pc.microPC());
+    } else {
+        curStaticInst = inst;
+    }
+
+    postDecode();
+}
+
+void
+BaseSimpleCPU::postDecode()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
     //If we decoded an instruction this "tick", record information about it.
     if (curStaticInst) {
 #if TRACING_ON
@@ -90,6 +90,11 @@ class BaseSimpleCPU : public BaseCPU
     void checkPcEventQueue();
     void swapActiveThread();
 
+    /** Work common to all instructions before getting the next one. */
+    void preDecode();
+    /** Trace and predict the instruction about to execute. */
+    void postDecode();
+
   public:
     BaseSimpleCPU(BaseSimpleCPUParams *params);
     virtual ~BaseSimpleCPU();
@@ -131,6 +136,14 @@ class BaseSimpleCPU : public BaseCPU
     void checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
     void preExecute();
+    /**
+     * Set up for executing an instruction decoded earlier instead of
+     * decoding what was fetched.
+     *
+     * @param inst The decoded instruction
+     * @param pc The PC state decoding the instruction resulted in
+     */
+    void preExecute(const StaticInstPtr &inst, const TheISA::PCState &pc);
     void postExecute();
     void advancePC(const Fault &fault);
 
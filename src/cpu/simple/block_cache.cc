@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/block_cache.hh"
+
+DecodedBlockCache::DecodedBlockCache(unsigned max_insts)
+    : maxInsts(max_insts), current(nullptr), currentIdx(0),
+      nextPaddr(MaxAddr), nextVaddr(MaxAddr), fetchPaddr(MaxAddr)
+{
+}
+
+bool
+DecodedBlockCache::enter(Addr paddr, Addr vaddr, uint64_t context)
+{
+    auto it = blocks.find(paddr);
+    if (it == blocks.end() || it->second->vaddr != vaddr ||
+        it->second->context != context) {
+        current = nullptr;
+        return false;
+    }
+
+    // the block being built runs into one we already have
+    endBlock();
+
+    current = it->second.get();
+    currentIdx = 0;
+    return true;
+}
+
+void
+DecodedBlockCache::record(const StaticInstPtr &inst,
+                          const TheISA::PCState &pc, uint64_t context,
+                          const TheISA::TyCHEAllocationPoint *sym)
+{
+    if (building && (building->context != context ||
+                     fetchPaddr != nextPaddr ||
+                     pc.instAddr() != nextVaddr ||
+                     building->insts.size() == maxInsts)) {
+        endBlock();
+    }
+
+    if (!building) {
+        building.reset(new Block);
+        building->paddr = fetchPaddr;
+        building->vaddr = pc.instAddr();
+        building->context = context;
+    }
+
+    building->insts.push_back(Inst{inst, pc, sym});
+
+    Addr size = pc.nextInstAddr() - pc.instAddr();
+    nextPaddr = fetchPaddr + size;
+    nextVaddr = pc.nextInstAddr();
+
+    // blocks never span pages, so that invalidating the page of the
+    // first instruction covers the whole block
+    if (pageOf(nextPaddr) != pageOf(building->paddr))
+        endBlock();
+}
+
+void
+DecodedBlockCache::endBlock()
+{
+    if (!building)
+        return;
+
+    Addr paddr = building->paddr;
+    auto &slot = blocks[paddr];
+    if (!slot)
+        pages[pageOf(paddr)].push_back(paddr);
+    slot = std::move(building);
+    nextPaddr = MaxAddr;
+    nextVaddr = MaxAddr;
+}
+
+void
+DecodedBlockCache::invalidatePage(Addr paddr)
+{
+    auto page = pages.find(pageOf(paddr));
+    if (page != pages.end()) {
+        for (Addr block_addr : page->second) {
+            auto it = blocks.find(block_addr);
+            if (it->second.get() == current)
+                current = nullptr;
+            blocks.erase(it);
+        }
+        pages.erase(page);
+    }
+
+    if (building && pageOf(building->paddr) == pageOf(paddr)) {
+        building.reset();
+        nextPaddr = MaxAddr;
+        nextVaddr = MaxAddr;
+    }
+}
+
+void
+DecodedBlockCache::clear()
+{
+    blocks.clear();
+    pages.clear();
+    building.reset();
+    current = nullptr;
+    nextPaddr = MaxAddr;
+    nextVaddr = MaxAddr;
+}
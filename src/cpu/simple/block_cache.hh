@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_BLOCK_CACHE_HH__
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "arch/TypeNode.hh"
+#include "arch/isa_traits.hh"
+#include "arch/types.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+
+/**
+ * A per-thread cache of decoded basic blocks for the atomic CPU.
+ *
+ * A block is a run of instructions that are contiguous in both the
+ * virtual and physical address space, decoded in the same decoder
+ * context. It ends at the end of a page, after an instruction that
+ * may change the control flow or the decoder context, or after a
+ * maximum number of instructions. Each instruction is kept with the
+ * PC state produced by decoding it, so executing from a block needs
+ * neither a fetch nor a decode.
+ *
+ * Blocks are found by the physical address of their first
+ * instruction. The owner is responsible for invalidating the pages
+ * that are written to, be it by its own stores or by snoops.
+ */
+class DecodedBlockCache
+{
+  public:
+    /** A decoded instruction and its PC once decoded. */
+    struct Inst
+    {
+        StaticInstPtr staticInst;
+        TheISA::PCState pc;
+        /** TyCHE allocation point tagging this PC, if any */
+        const TheISA::TyCHEAllocationPoint *sym;
+    };
+
+    struct Block
+    {
+        Addr paddr;
+        Addr vaddr;
+        /** Decoder context the instructions were decoded in */
+        uint64_t context;
+        std::vector<Inst> insts;
+    };
+
+    /**
+     * @param max_insts Maximum number of instructions in a block
+     */
+    DecodedBlockCache(unsigned max_insts);
+
+    /**
+     * Start executing from the block at the given address, if there
+     * is one for the same virtual address and decoder context.
+     *
+     * @return true if a block was found
+     */
+    bool enter(Addr paddr, Addr vaddr, uint64_t context);
+
+    /**
+     * Get the next instruction of the block being executed. The
+     * block is left if it is done or if the PC or decoder context
+     * don't match what the block expects, e.g. after an interrupt.
+     *
+     * @return The instruction, or nullptr when not in a block
+     */
+    const Inst *
+    next(const TheISA::PCState &pc, uint64_t context)
+    {
+        if (!current)
+            return nullptr;
+
+        const Inst *inst = &current->insts[currentIdx];
+        if (inst->pc.instAddr() != pc.instAddr() ||
+            current->context != context) {
+            current = nullptr;
+            return nullptr;
+        }
+
+        if (++currentIdx == current->insts.size())
+            current = nullptr;
+        return inst;
+    }
+
+    /** Check if there are more instructions in the current block. */
+    bool inBlock() const { return current != nullptr; }
+
+    /** Stop executing from the current block. */
+    void leaveBlock() { current = nullptr; }
+
+    /** Set the physical address of the instruction being fetched. */
+    void fetchAddr(Addr paddr) { fetchPaddr = paddr; }
+
+    /**
+     * Add an instruction decoded the normal way to the block being
+     * built, starting a new one if it doesn't follow on from it. The
+     * physical address is the last one passed to fetchAddr().
+     */
+    void record(const StaticInstPtr &inst, const TheISA::PCState &pc,
+                uint64_t context, const TheISA::TyCHEAllocationPoint *sym);
+
+    /** Finish the block being built, making it available. */
+    void endBlock();
+
+    /** Check if a page holds the start of any cached block. */
+    bool
+    isCodePage(Addr paddr) const
+    {
+        return !pages.empty() && pages.count(pageOf(paddr));
+    }
+
+    /** Drop all blocks starting in the page of the given address. */
+    void invalidatePage(Addr paddr);
+
+    /** Drop all blocks. */
+    void clear();
+
+  protected:
+    static Addr pageOf(Addr addr) { return addr >> TheISA::PageShift; }
+
+    const unsigned maxInsts;
+
+    /** Blocks by the physical address of their first instruction */
+    std::unordered_map<Addr, std::unique_ptr<Block>> blocks;
+
+    /** Block start addresses by physical page */
+    std::unordered_map<Addr, std::vector<Addr>> pages;
+
+    /** Block being executed, and the index of its next instruction */
+    const Block *current;
+    size_t currentIdx;
+
+    /** Block being built, and where its next instruction should be */
+    std::unique_ptr<Block> building;
+    Addr nextPaddr;
+    Addr nextVaddr;
+
+    Addr fetchPaddr;
+};
+
+#endif // __CPU_SIMPLE_BLOCK_CACHE_HH__
@@ -46,3 +46,12 @@ class SimPoint(ProbeListenerObject):
 
     interval = Param.UInt64(100000000, "Interval Size (insts)")
     profile_file = Param.String("simpoint.bb.gz", "BBV (output) file")
+
+    # Clustering of the BBVs into SimPoints at the end of the simulation
+    max_k = Param.Unsigned(0, "Maximum number of clusters (0: don't cluster)")
+    projection_dims = Param.Unsigned(15,
+        "Dimensions the BBVs are randomly projected to for clustering")
+    seed = Param.UInt32(1, "Seed of the projection and k-means")
+    simpoints_file = Param.String("simpoint.simpts", "SimPoints (output) file")
+    weights_file = Param.String("simpoint.weights",
+        "SimPoint weights (output) file")
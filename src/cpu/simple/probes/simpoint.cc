@@ -40,7 +40,11 @@
 
 #include "cpu/simple/probes/simpoint.hh"
 
+#include <iomanip>
+
+#include "base/callback.hh"
 #include "base/output.hh"
+#include "sim/core.hh"
 
 SimPoint::SimPoint(const SimPointParams *p)
     : ProbeListenerObject(p),
@@ -49,16 +53,50 @@ SimPoint::SimPoint(const SimPointParams *p)
       intervalDrift(0),
       simpointStream(NULL),
       currentBBV(0, 0),
-      currentBBVInstCount(0)
+      currentBBVInstCount(0),
+      clustering(nullptr),
+      simpointsFile(p->simpoints_file),
+      weightsFile(p->weights_file)
 {
     simpointStream = simout.create(p->profile_file, false);
     if (!simpointStream)
         fatal("unable to open SimPoint profile_file");
+
+    if (p->max_k) {
+        clustering = new SimPointCluster(p->projection_dims, p->max_k,
+                                         p->seed);
+        registerExitCallback(
+            new MakeCallback<SimPoint, &SimPoint::selectSimPoints>(this));
+    }
 }
 
 SimPoint::~SimPoint()
 {
     simout.close(simpointStream);
+    delete clustering;
+}
+
+void
+SimPoint::selectSimPoints()
+{
+    auto simpoints = clustering->select();
+
+    OutputStream *simpoints_stream = simout.create(simpointsFile, false);
+    OutputStream *weights_stream = simout.create(weightsFile, false);
+    if (!simpoints_stream || !weights_stream)
+        fatal("unable to open SimPoint simpoints_file or weights_file");
+
+    for (size_t i = 0; i < simpoints.size(); ++i) {
+        *simpoints_stream->stream() << simpoints[i].interval << " "
+                                    << i << "\n";
+        *weights_stream->stream() << std::setprecision(9)
+                                  << simpoints[i].weight << " " << i << "\n";
+    }
+    simout.close(simpoints_stream);
+    simout.close(weights_stream);
+
+    inform("SimPoint: picked %d SimPoints out of %d intervals\n",
+           simpoints.size(), clustering->intervals());
 }
 
 void
@@ -125,6 +163,8 @@ SimPoint::profile(const std::pair<SimpleThread*, StaticInstPtr>& p)
                 }
             }
             std::sort(counts.begin(), counts.end());
+            if (clustering)
+                clustering->addInterval(counts);
 
             // Print output BBV info
             *simpointStream->stream() << "T";
@@ -44,6 +44,7 @@
 #include <unordered_map>
 
 #include "base/output.hh"
+#include "cpu/simple/probes/simpoint_cluster.hh"
 #include "cpu/simple_thread.hh"
 #include "params/SimPoint.hh"
 #include "sim/probe/probe.hh"
@@ -89,6 +90,13 @@ class SimPoint : public ProbeListenerObject
      */
     void profile(const std::pair<SimpleThread*, StaticInstPtr>&);
 
+    /**
+     * Cluster the profiled intervals and write the SimPoints and their
+     * weights in the format of the SimPoint tool. Called on exit when
+     * clustering is enabled.
+     */
+    void selectSimPoints();
+
   private:
     /** SimPoint profiling interval size in instructions */
     const uint64_t intervalSize;
@@ -116,6 +124,12 @@ class SimPoint : public ProbeListenerObject
     BasicBlockRange currentBBV;
     /** inst count in current basic block */
     uint64_t currentBBVInstCount;
+
+    /** Clustering of the intervals, null if disabled */
+    SimPointCluster *clustering;
+    /** SimPoint and weight output file names */
+    const std::string simpointsFile;
+    const std::string weightsFile;
 };
 
 #endif // __CPU_SIMPLE_PROBES_SIMPOINT_HH__
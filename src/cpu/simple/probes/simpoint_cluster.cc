@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/probes/simpoint_cluster.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "base/logging.hh"
+
+SimPointCluster::SimPointCluster(unsigned _dims, unsigned max_k,
+                                 uint32_t seed)
+    : dims(_dims), maxK(max_k), rng(seed), numIntervals(0)
+{
+    fatal_if(!dims, "SimPoint clustering needs at least one dimension");
+}
+
+void
+SimPointCluster::addInterval(const BBV &bbv)
+{
+    uint64_t total = 0;
+    for (const auto &bb : bbv)
+        total += bb.second;
+
+    points.resize((numIntervals + 1) * dims, 0.0);
+    double *p = &points[numIntervals * dims];
+    ++numIntervals;
+    if (!total)
+        return;
+
+    for (const auto &bb : bbv) {
+        // Draw the rows in id order, so the projection doesn't depend
+        // on the order the blocks were first seen in
+        while (projection.size() < (bb.first + 1) * dims)
+            projection.push_back(randomReal() * 2.0 - 1.0);
+
+        const double freq = double(bb.second) / total;
+        const double *row = &projection[bb.first * dims];
+        for (unsigned d = 0; d < dims; ++d)
+            p[d] += freq * row[d];
+    }
+}
+
+double
+SimPointCluster::randomReal()
+{
+    std::uniform_real_distribution<double> dist;
+    return dist(rng);
+}
+
+size_t
+SimPointCluster::randomInterval()
+{
+    std::uniform_int_distribution<uint64_t> dist(0, numIntervals - 1);
+    return dist(rng);
+}
+
+double
+SimPointCluster::distance(const double *a, const double *b) const
+{
+    double dist = 0;
+    for (unsigned d = 0; d < dims; ++d)
+        dist += (a[d] - b[d]) * (a[d] - b[d]);
+    return dist;
+}
+
+void
+SimPointCluster::seedCentres(Clustering &c, unsigned k)
+{
+    // k-means++: each centre is drawn with a probability proportional
+    // to its squared distance from the ones picked before
+    c.centres.assign(k * dims, 0.0);
+    size_t first = randomInterval();
+    std::copy(point(first), point(first) + dims, c.centres.begin());
+
+    std::vector<double> nearest(numIntervals);
+    for (size_t i = 0; i < numIntervals; ++i)
+        nearest[i] = distance(point(i), &c.centres[0]);
+
+    for (unsigned j = 1; j < k; ++j) {
+        double total = 0;
+        for (auto dist : nearest)
+            total += dist;
+
+        size_t pick = numIntervals - 1;
+        if (total > 0) {
+            double target = randomReal() * total;
+            for (size_t i = 0; i < numIntervals; ++i) {
+                target -= nearest[i];
+                if (target < 0) {
+                    pick = i;
+                    break;
+                }
+            }
+        } else {
+            pick = randomInterval();
+        }
+
+        double *centre = &c.centres[j * dims];
+        std::copy(point(pick), point(pick) + dims, centre);
+        for (size_t i = 0; i < numIntervals; ++i)
+            nearest[i] = std::min(nearest[i], distance(point(i), centre));
+    }
+}
+
+SimPointCluster::Clustering
+SimPointCluster::kmeans(unsigned k)
+{
+    Clustering best;
+    best.distortion = std::numeric_limits<double>::infinity();
+
+    for (unsigned init = 0; init < numInits; ++init) {
+        Clustering c;
+        seedCentres(c, k);
+        c.assignment.assign(numIntervals, k);
+
+        for (unsigned iter = 0; iter < maxIterations; ++iter) {
+            bool changed = false;
+            c.distortion = 0;
+            for (size_t i = 0; i < numIntervals; ++i) {
+                unsigned closest = 0;
+                double closest_dist = std::numeric_limits<double>::max();
+                for (unsigned j = 0; j < k; ++j) {
+                    double dist = distance(point(i), &c.centres[j * dims]);
+                    if (dist < closest_dist) {
+                        closest = j;
+                        closest_dist = dist;
+                    }
+                }
+                changed |= c.assignment[i] != closest;
+                c.assignment[i] = closest;
+                c.distortion += closest_dist;
+            }
+            if (!changed)
+                break;
+
+            // Move the centres to the mean of their intervals, a
+            // centre left without any stays where it is
+            std::vector<double> sums(k * dims, 0.0);
+            std::vector<size_t> sizes(k, 0);
+            for (size_t i = 0; i < numIntervals; ++i) {
+                const unsigned j = c.assignment[i];
+                ++sizes[j];
+                for (unsigned d = 0; d < dims; ++d)
+                    sums[j * dims + d] += point(i)[d];
+            }
+            for (unsigned j = 0; j < k; ++j) {
+                if (!sizes[j])
+                    continue;
+                for (unsigned d = 0; d < dims; ++d)
+                    c.centres[j * dims + d] = sums[j * dims + d] / sizes[j];
+            }
+        }
+
+        if (c.distortion < best.distortion)
+            best = std::move(c);
+    }
+
+    return best;
+}
+
+double
+SimPointCluster::bic(const Clustering &c, unsigned k) const
+{
+    const double r = numIntervals;
+    std::vector<size_t> sizes(k, 0);
+    for (auto j : c.assignment)
+        ++sizes[j];
+
+    // Identical spherical Gaussians, keep the variance of a perfect
+    // fit from sending the log to infinity
+    double variance = numIntervals > k ? c.distortion / (r - k) : 0.0;
+    variance = std::max(variance, std::numeric_limits<double>::min());
+
+    double log_likelihood = 0;
+    for (auto size : sizes) {
+        if (!size)
+            continue;
+        const double rn = size;
+        log_likelihood += -rn / 2 * std::log(2 * M_PI)
+            - rn * dims / 2 * std::log(variance)
+            - (rn - k) / 2
+            + rn * std::log(rn) - rn * std::log(r);
+    }
+
+    // Mixture weights, centres and the variance
+    const double params = (k - 1) + double(dims) * k + 1;
+    return log_likelihood - params / 2 * std::log(r);
+}
+
+std::vector<SimPointCluster::SimPointInfo>
+SimPointCluster::select()
+{
+    std::vector<SimPointInfo> simpoints;
+    if (!numIntervals)
+        return simpoints;
+
+    const unsigned max_k = std::min<uint64_t>(maxK, numIntervals);
+    std::vector<Clustering> clusterings;
+    std::vector<double> scores;
+    for (unsigned k = 1; k <= max_k; ++k) {
+        clusterings.push_back(kmeans(k));
+        scores.push_back(bic(clusterings.back(), k));
+    }
+
+    const double min_score = *std::min_element(scores.begin(), scores.end());
+    const double max_score = *std::max_element(scores.begin(), scores.end());
+    const double threshold =
+        min_score + bicThreshold * (max_score - min_score);
+    unsigned pick = 0;
+    while (scores[pick] < threshold)
+        ++pick;
+    const Clustering &c = clusterings[pick];
+    const unsigned k = pick + 1;
+
+    // The interval closest to its centre represents each cluster
+    std::vector<size_t> sizes(k, 0);
+    std::vector<size_t> closest(k, numIntervals);
+    std::vector<double> closest_dist(k);
+    for (size_t i = 0; i < numIntervals; ++i) {
+        const unsigned j = c.assignment[i];
+        const double dist = distance(point(i), &c.centres[j * dims]);
+        ++sizes[j];
+        if (closest[j] == numIntervals || dist < closest_dist[j]) {
+            closest[j] = i;
+            closest_dist[j] = dist;
+        }
+    }
+
+    for (unsigned j = 0; j < k; ++j) {
+        if (sizes[j])
+            simpoints.push_back({closest[j], double(sizes[j]) / numIntervals});
+    }
+    return simpoints;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_PROBES_SIMPOINT_CLUSTER_HH__
+#define __CPU_SIMPLE_PROBES_SIMPOINT_CLUSTER_HH__
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+/**
+ * Picks SimPoints from the BBVs of a profile, the way the SimPoint
+ * tool does: the BBVs are randomly projected to a few dimensions and
+ * clustered with k-means for every k up to a maximum. The smallest k
+ * whose BIC score gets close enough to the best one wins, and the
+ * interval closest to the centre of each of its clusters represents
+ * the cluster.
+ *
+ * Only the projected BBVs are kept, so memory grows with the number
+ * of intervals rather than with the number of basic blocks.
+ */
+class SimPointCluster
+{
+  public:
+    /** A representative interval and the share of the run it stands for */
+    struct SimPointInfo
+    {
+        uint64_t interval;
+        double weight;
+    };
+
+    /** BBV of an interval as (basic block id, inst count) pairs */
+    typedef std::vector<std::pair<uint64_t, uint64_t>> BBV;
+
+    SimPointCluster(unsigned dims, unsigned max_k, uint32_t seed);
+
+    /** Add the BBV of the next interval */
+    void addInterval(const BBV &bbv);
+
+    /** Number of intervals added so far */
+    size_t intervals() const { return numIntervals; }
+
+    /** Cluster the intervals and pick one SimPoint per cluster */
+    std::vector<SimPointInfo> select();
+
+  private:
+    /** Centres and cluster of each interval of one k-means run */
+    struct Clustering
+    {
+        std::vector<double> centres;
+        std::vector<unsigned> assignment;
+        double distortion;
+    };
+
+    /** k-means runs from different initial centres, the best is kept */
+    static const unsigned numInits = 5;
+    /** Maximum k-means iterations of a run */
+    static const unsigned maxIterations = 100;
+    /** Share of the BIC range the picked k has to reach */
+    static constexpr double bicThreshold = 0.9;
+
+    const unsigned dims;
+    const unsigned maxK;
+    /**
+     * Not a Random, so that the clustering doesn't depend on the
+     * checkpointing code and can be unit tested on its own
+     */
+    std::mt19937_64 rng;
+
+    /** Projection row of each basic block, by id */
+    std::vector<double> projection;
+    /** Projected BBV of each interval */
+    std::vector<double> points;
+    size_t numIntervals;
+
+    const double *point(size_t i) const { return &points[i * dims]; }
+
+    /** Uniform in [0, 1) */
+    double randomReal();
+    /** Uniform interval number */
+    size_t randomInterval();
+
+    double distance(const double *a, const double *b) const;
+
+    Clustering kmeans(unsigned k);
+    void seedCentres(Clustering &c, unsigned k);
+
+    /** Bayesian Information Criterion of a clustering, as in x-means */
+    double bic(const Clustering &c, unsigned k) const;
+};
+
+#endif // __CPU_SIMPLE_PROBES_SIMPOINT_CLUSTER_HH__
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "cpu/simple/probes/simpoint_cluster.hh"
+
+namespace {
+
+/**
+ * BBV of an interval of a phase. Each phase runs its own ten basic
+ * blocks, with some noise in the counts.
+ */
+SimPointCluster::BBV
+phaseBBV(unsigned phase, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<uint64_t> noise(0, 100);
+    SimPointCluster::BBV bbv;
+    for (uint64_t bb = 0; bb < 10; ++bb)
+        bbv.emplace_back(phase * 10 + bb, 1000 * (bb + 1) + noise(gen));
+    return bbv;
+}
+
+/** Add intervals of the given phases and record each one's phase */
+void
+addPhases(SimPointCluster &cluster, const std::vector<unsigned> &phases,
+          std::vector<unsigned> &interval_phase)
+{
+    std::mt19937 gen(1);
+    for (auto phase : phases) {
+        cluster.addInterval(phaseBBV(phase, gen));
+        interval_phase.push_back(phase);
+    }
+}
+
+double
+totalWeight(const std::vector<SimPointCluster::SimPointInfo> &simpoints)
+{
+    double total = 0;
+    for (const auto &sp : simpoints)
+        total += sp.weight;
+    return total;
+}
+
+} // anonymous namespace
+
+TEST(SimPointClusterTest, NoIntervals)
+{
+    SimPointCluster cluster(15, 10, 1);
+    EXPECT_TRUE(cluster.select().empty());
+}
+
+TEST(SimPointClusterTest, IdenticalIntervals)
+{
+    SimPointCluster cluster(15, 10, 1);
+    std::mt19937 gen(1);
+    const SimPointCluster::BBV bbv = phaseBBV(0, gen);
+    for (unsigned i = 0; i < 40; ++i)
+        cluster.addInterval(bbv);
+
+    auto simpoints = cluster.select();
+    ASSERT_EQ(simpoints.size(), 1);
+    EXPECT_LT(simpoints[0].interval, 40);
+    EXPECT_DOUBLE_EQ(simpoints[0].weight, 1.0);
+}
+
+TEST(SimPointClusterTest, ThreePhases)
+{
+    // Phases 0, 1 and 2 take 50%, 30% and 20% of the run, in
+    // interleaved stretches
+    std::vector<unsigned> phases;
+    for (unsigned rep = 0; rep < 5; ++rep) {
+        phases.insert(phases.end(), 10, 0);
+        phases.insert(phases.end(), 6, 1);
+        phases.insert(phases.end(), 4, 2);
+    }
+
+    SimPointCluster cluster(15, 10, 1);
+    std::vector<unsigned> interval_phase;
+    addPhases(cluster, phases, interval_phase);
+    EXPECT_EQ(cluster.intervals(), 100);
+
+    auto simpoints = cluster.select();
+    ASSERT_EQ(simpoints.size(), 3);
+    EXPECT_NEAR(totalWeight(simpoints), 1.0, 1e-9);
+
+    // One representative per phase, weighted by the phase's share
+    const double shares[] = { 0.5, 0.3, 0.2 };
+    std::vector<bool> seen(3, false);
+    for (const auto &sp : simpoints) {
+        ASSERT_LT(sp.interval, interval_phase.size());
+        const unsigned phase = interval_phase[sp.interval];
+        EXPECT_FALSE(seen[phase]);
+        seen[phase] = true;
+        EXPECT_DOUBLE_EQ(sp.weight, shares[phase]);
+    }
+}
+
+TEST(SimPointClusterTest, MaxKLimitsClusters)
+{
+    std::vector<unsigned> phases;
+    for (unsigned phase = 0; phase < 4; ++phase)
+        phases.insert(phases.end(), 10, phase);
+
+    SimPointCluster cluster(15, 2, 1);
+    std::vector<unsigned> interval_phase;
+    addPhases(cluster, phases, interval_phase);
+
+    auto simpoints = cluster.select();
+    EXPECT_LE(simpoints.size(), 2);
+    EXPECT_NEAR(totalWeight(simpoints), 1.0, 1e-9);
+}
+
+TEST(SimPointClusterTest, SameSeedSameSimPoints)
+{
+    std::vector<unsigned> phases;
+    for (unsigned i = 0; i < 60; ++i)
+        phases.push_back(i % 3 == 0 ? i % 2 : 2);
+
+    SimPointCluster a(15, 10, 7), b(15, 10, 7);
+    std::vector<unsigned> phase_a, phase_b;
+    addPhases(a, phases, phase_a);
+    addPhases(b, phases, phase_b);
+
+    auto sp_a = a.select();
+    auto sp_b = b.select();
+    ASSERT_EQ(sp_a.size(), sp_b.size());
+    for (size_t i = 0; i < sp_a.size(); ++i) {
+        EXPECT_EQ(sp_a[i].interval, sp_b[i].interval);
+        EXPECT_EQ(sp_a[i].weight, sp_b[i].weight);
+    }
+}
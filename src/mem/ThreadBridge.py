@@ -0,0 +1,47 @@
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from MemObject import MemObject
+
+# A bridge between two event queues that are simulated by different
+# threads. The slave side is on the event queue of the bridge, the
+# master side on master_eventq_index. Packets cross the bridge at
+# quantum boundaries, so the latency is at least one simulation
+# quantum. Snoops reach the slave side a quantum late, so no cache may
+# sit above the bridge.
+class ThreadBridge(MemObject):
+    type = 'ThreadBridge'
+    cxx_header = "mem/thread_bridge.hh"
+
+    slave = SlavePort('Slave port, on the event queue of the bridge')
+    master = MasterPort('Master port, on the event queue of the master side')
+
+    master_eventq_index = Param.UInt32("Event queue of the master side")
+
+    delay = Param.Latency('0ns', "Latency of the bridge, raised to the "
+                          "simulation quantum if shorter")
+    req_size = Param.Unsigned(16, "Number of requests awaiting a response")
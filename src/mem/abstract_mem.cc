@@ -59,7 +59,7 @@ using namespace std;
 AbstractMemory::AbstractMemory(const Params *p) :
     MemObject(p), range(params()->range), pmemAddr(NULL),
     confTableReported(p->conf_table_reported), inAddrMap(p->in_addr_map),
-    kvmMap(p->kvm_map), _system(NULL)
+    kvmMap(p->kvm_map), backdoorGranted(false), _system(NULL)
 {
 }
 
@@ -75,9 +75,34 @@ AbstractMemory::init()
 void
 AbstractMemory::setBackingStore(uint8_t* pmem_addr)
 {
+    revokeBackdoors();
     pmemAddr = pmem_addr;
 }
 
+bool
+AbstractMemory::getBackdoor(MemBackdoor &backdoor, Tick latency)
+{
+    if (!pmemAddr || range.interleaved())
+        return false;
+
+    backdoor = MemBackdoor(range, pmemAddr, latency,
+                           lockedAddrList.empty() ? MemBackdoor::ReadWrite :
+                           MemBackdoor::Readable);
+    backdoorGranted = true;
+    return true;
+}
+
+void
+AbstractMemory::revokeBackdoors()
+{
+    if (backdoorGranted) {
+        DPRINTF(MemoryAccess, "Revoking backdoors to %s\n",
+                range.to_string());
+        backdoorGranted = false;
+        sendBackdoorInvalidate(range);
+    }
+}
+
 void
 AbstractMemory::regStats()
 {
@@ -219,6 +244,10 @@ AbstractMemory::trackLoadLocked(PacketPtr pkt)
     // no record for this xc: need to allocate a new one
     DPRINTF(LLSC, "Adding lock record: context %d addr %#x\n",
             req->contextId(), paddr);
+    // stores must now be checked against the lock, so stop handing
+    // them out through backdoors
+    if (lockedAddrList.empty())
+        revokeBackdoors();
     lockedAddrList.push_front(LockedAddr(req));
 }
 
@@ -49,6 +49,7 @@
 #ifndef __MEM_ABSTRACT_MEMORY_HH__
 #define __MEM_ABSTRACT_MEMORY_HH__
 
+#include "mem/backdoor.hh"
 #include "mem/mem_object.hh"
 #include "params/AbstractMemory.hh"
 #include "sim/stats.hh"
@@ -154,6 +155,35 @@ class AbstractMemory : public MemObject
         }
     }
 
+    /** True if a backdoor to this memory may be held by a master */
+    bool backdoorGranted;
+
+    /**
+     * Fill in a backdoor covering the whole memory. Grants are only
+     * handed out for non-interleaved memories with a backing store,
+     * and are read-only while load-locked addresses are tracked so
+     * that stores keep going through writeOK(). Accesses through the
+     * backdoor are not included in the memory statistics.
+     *
+     * @param backdoor Grant to fill in
+     * @param latency Latency to charge per access
+     * @return true if a grant was made
+     */
+    bool getBackdoor(MemBackdoor &backdoor, Tick latency);
+
+    /**
+     * Revoke all backdoors to this memory, e.g. when the backing
+     * store changes or the first address gets locked.
+     */
+    void revokeBackdoors();
+
+    /**
+     * Notify the masters holding backdoors that they are no longer
+     * valid. Memories that grant backdoors forward this to their
+     * slave port.
+     */
+    virtual void sendBackdoorInvalidate(const AddrRange &r) { }
+
     /** Number of total bytes read from this memory */
     Stats::Vector bytesRead;
     /** Number of instruction bytes read from this memory */
@@ -227,7 +257,12 @@ class AbstractMemory : public MemObject
     /**
      * Add a locked address to allow for checkpointing.
      */
-    void addLockedAddr(LockedAddr addr) { lockedAddrList.push_back(addr); }
+    void addLockedAddr(LockedAddr addr)
+    {
+        if (lockedAddrList.empty())
+            revokeBackdoors();
+        lockedAddrList.push_back(addr);
+    }
 
     /** read the system pointer
      * Implemented for completeness with the setter
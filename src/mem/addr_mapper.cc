@@ -101,6 +101,18 @@ AddrMapper::recvAtomic(PacketPtr pkt)
     return ret_tick;
 }
 
+Tick
+AddrMapper::recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+{
+    Addr orig_addr = pkt->getAddr();
+    pkt->setAddr(remapAddr(orig_addr));
+    Tick ret_tick = masterPort.sendAtomicBackdoor(pkt, backdoor);
+    pkt->setAddr(orig_addr);
+    if (backdoor.valid())
+        remapBackdoor(orig_addr, backdoor);
+    return ret_tick;
+}
+
 Tick
 AddrMapper::recvAtomicSnoop(PacketPtr pkt)
 {
@@ -210,6 +222,14 @@ AddrMapper::recvRangeChange()
     slavePort.sendRangeChange();
 }
 
+void
+AddrMapper::recvBackdoorInvalidate(const AddrRange &range)
+{
+    // the range is in the remapped address space, and may correspond
+    // to several original ranges, so simply revoke everything
+    slavePort.sendBackdoorInvalidate(AddrRange(0, MaxAddr));
+}
+
 RangeAddrMapper::RangeAddrMapper(const RangeAddrMapperParams* p) :
     AddrMapper(p),
     originalRanges(p->original_ranges),
@@ -245,6 +265,30 @@ RangeAddrMapper::remapAddr(Addr addr) const
     return addr;
 }
 
+void
+RangeAddrMapper::remapBackdoor(Addr orig_addr, MemBackdoor &backdoor) const
+{
+    for (int i = 0; i < originalRanges.size(); ++i) {
+        if (originalRanges[i].contains(orig_addr)) {
+            if (originalRanges[i].interleaved())
+                break;
+            // only the part of the grant that is mapped by this range
+            // can be used from the original address space
+            backdoor.clip(remappedRanges[i]);
+            if (backdoor.valid()) {
+                backdoor.rebase(backdoor.range().start() -
+                                remappedRanges[i].start() +
+                                originalRanges[i].start());
+            }
+            return;
+        }
+    }
+
+    // addresses that are not remapped pass through unchanged, but the
+    // grant would cover remapped ranges as well
+    backdoor.reset();
+}
+
 AddrRangeList
 RangeAddrMapper::getAddrRanges() const
 {
@@ -81,6 +81,20 @@ class AddrMapper : public MemObject
      */
     virtual Addr remapAddr(Addr addr) const = 0;
 
+    /**
+     * Translate a backdoor obtained for the remapped address of
+     * orig_addr back to the original address space. Mappers that
+     * cannot express this as a contiguous range drop the grant,
+     * which is also the default.
+     *
+     * @param orig_addr Original address of the access
+     * @param backdoor Grant in the remapped address space
+     */
+    virtual void remapBackdoor(Addr orig_addr, MemBackdoor &backdoor) const
+    {
+        backdoor.reset();
+    }
+
     class AddrMapperSenderState : public Packet::SenderState
     {
 
@@ -138,6 +152,11 @@ class AddrMapper : public MemObject
             mapper.recvRangeChange();
         }
 
+        void recvBackdoorInvalidate(const AddrRange &range)
+        {
+            mapper.recvBackdoorInvalidate(range);
+        }
+
         bool isSnooping() const
         {
             return mapper.isSnooping();
@@ -178,6 +197,11 @@ class AddrMapper : public MemObject
             return mapper.recvAtomic(pkt);
         }
 
+        Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+        {
+            return mapper.recvAtomicBackdoor(pkt, backdoor);
+        }
+
         bool recvTimingReq(PacketPtr pkt)
         {
             return mapper.recvTimingReq(pkt);
@@ -213,6 +237,8 @@ class AddrMapper : public MemObject
 
     Tick recvAtomic(PacketPtr pkt);
 
+    Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor);
+
     Tick recvAtomicSnoop(PacketPtr pkt);
 
     bool recvTimingReq(PacketPtr pkt);
@@ -232,6 +258,8 @@ class AddrMapper : public MemObject
     void recvRespRetry();
 
     void recvRangeChange();
+
+    void recvBackdoorInvalidate(const AddrRange &range);
 };
 
 /**
@@ -268,6 +296,8 @@ class RangeAddrMapper : public AddrMapper
 
     Addr remapAddr(Addr addr) const;
 
+    void remapBackdoor(Addr orig_addr, MemBackdoor &backdoor) const;
+
 };
 
 #endif //__MEM_ADDR_MAPPER_HH__
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Direct memory interface (backdoor) grants handed out on the atomic
+ * path.
+ */
+
+#ifndef __MEM_BACKDOOR_HH__
+#define __MEM_BACKDOOR_HH__
+
+#include <algorithm>
+#include <cstdint>
+
+#include "base/addr_range.hh"
+#include "base/types.hh"
+
+/**
+ * A MemBackdoor describes a contiguous range of simulated memory that
+ * is backed by host memory, and that a master may access directly
+ * instead of sending packets. A grant is obtained as a side effect of
+ * MasterPort::sendAtomicBackdoor and stays valid until the slave
+ * revokes it with SlavePort::sendBackdoorInvalidate. Accesses through
+ * a backdoor are invisible to the objects along the path, so only
+ * objects that neither keep state nor observe the traffic for a
+ * range should hand one out.
+ */
+class MemBackdoor
+{
+  public:
+
+    enum Flags
+    {
+        NoAccess = 0x0,
+        Readable = 0x1,
+        Writeable = 0x2,
+        ReadWrite = Readable | Writeable
+    };
+
+    MemBackdoor()
+        : _ptr(nullptr), _latency(0), _flags(NoAccess)
+    {}
+
+    MemBackdoor(const AddrRange &range, uint8_t *ptr, Tick latency,
+                Flags flags)
+        : _range(range), _ptr(ptr), _latency(latency), _flags(flags)
+    {}
+
+    /** True if this describes an actual grant. */
+    bool valid() const { return _ptr != nullptr && _flags != NoAccess; }
+
+    /** Address range covered by the grant. */
+    const AddrRange &range() const { return _range; }
+
+    /** Host pointer corresponding to range().start(). */
+    uint8_t *ptr() const { return _ptr; }
+
+    /** Latency to charge for each access through the backdoor. */
+    Tick latency() const { return _latency; }
+
+    bool readable() const { return _flags & Readable; }
+    bool writeable() const { return _flags & Writeable; }
+
+    Flags flags() const { return _flags; }
+
+    /** Host pointer for a simulated address inside the range. */
+    uint8_t *
+    hostAddr(Addr addr) const
+    {
+        return _ptr + (addr - _range.start());
+    }
+
+    /**
+     * Restrict the grant to the part of its range that falls within
+     * a sub-range, keeping the host pointer consistent. The grant is
+     * dropped if the two do not overlap.
+     */
+    void
+    clip(const AddrRange &r)
+    {
+        if (!valid() || r.interleaved() || !r.intersects(_range)) {
+            reset();
+            return;
+        }
+        Addr start = std::max(r.start(), _range.start());
+        Addr end = std::min(r.end(), _range.end());
+        _ptr += start - _range.start();
+        _range = AddrRange(start, end);
+    }
+
+    /** Move the grant to a different simulated base address. */
+    void
+    rebase(Addr start)
+    {
+        _range = AddrRange(start, start + _range.size() - 1);
+    }
+
+    /** Add the latency of an object along the path. */
+    void addLatency(Tick latency) { _latency += latency; }
+
+    void reset() { *this = MemBackdoor(); }
+
+  private:
+
+    AddrRange _range;
+    uint8_t *_ptr;
+    Tick _latency;
+    Flags _flags;
+};
+
+#endif //__MEM_BACKDOOR_HH__
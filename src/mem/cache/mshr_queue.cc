@@ -64,10 +64,11 @@ MSHRQueue::allocate(Addr blk_addr, unsigned blk_size, PacketPtr pkt,
     assert(!freeList.empty());
     MSHR *mshr = freeList.front();
     assert(mshr->getNumTargets() == 0);
-    freeList.pop_front();
 
     mshr->allocate(blk_addr, blk_size, pkt, when_ready, order, alloc_on_fill);
-    mshr->allocIter = allocatedList.insert(allocatedList.end(), mshr);
+    mshr->allocIter = freeList.begin();
+    allocatedList.splice(allocatedList.end(), freeList, freeList.begin());
+    addToIndex(mshr);
     mshr->readyIter = addToReadyList(mshr);
 
     allocated += 1;
@@ -51,7 +51,9 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
 #include "debug/Drain.hh"
@@ -96,6 +98,47 @@ class Queue : public Drainable
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
+    /**
+     * Block address index over the allocated entries. Each bucket
+     * heads a chain linked through QueueEntry::indexNext, kept in
+     * allocation order so that lookups see entries in the same order
+     * as a walk of the allocatedList.
+     */
+    std::vector<QueueEntry*> indexBuckets;
+
+    /** Shift turning the hashed block address into a bucket index. */
+    const unsigned indexShift;
+
+    unsigned indexBucket(Addr blk_addr) const
+    {
+        return (blk_addr * 0x9e3779b97f4a7c15ULL) >> indexShift;
+    }
+
+    /**
+     * Add a newly allocated entry to the block address index. Must be
+     * called once the entry holds its block address.
+     */
+    void addToIndex(Entry *entry)
+    {
+        QueueEntry **link = &indexBuckets[indexBucket(entry->blkAddr)];
+        while (*link) {
+            link = &(*link)->indexNext;
+        }
+        entry->indexNext = nullptr;
+        *link = entry;
+    }
+
+    void removeFromIndex(Entry *entry)
+    {
+        QueueEntry **link = &indexBuckets[indexBucket(entry->blkAddr)];
+        while (*link != entry) {
+            assert(*link);
+            link = &(*link)->indexNext;
+        }
+        *link = entry->indexNext;
+        entry->indexNext = nullptr;
+    }
+
     typename Entry::Iterator addToReadyList(Entry* entry)
     {
         if (readyList.empty() ||
@@ -128,8 +171,10 @@ class Queue : public Drainable
      */
     Queue(const std::string &_label, int num_entries, int reserve) :
         label(_label), numEntries(num_entries + reserve),
-        numReserve(reserve), entries(numEntries), _numInService(0),
-        allocated(0)
+        numReserve(reserve), entries(numEntries),
+        indexBuckets((size_t)1 << ceilLog2(2 * numEntries), nullptr),
+        indexShift(64 - ceilLog2(2 * numEntries)),
+        _numInService(0), allocated(0)
     {
         for (int i = 0; i < numEntries; ++i) {
             freeList.push_back(&entries[i]);
@@ -162,7 +207,9 @@ class Queue : public Drainable
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        for (QueueEntry *e = indexBuckets[indexBucket(blk_addr)]; e;
+             e = e->indexNext) {
+            Entry *entry = static_cast<Entry*>(e);
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
@@ -180,7 +227,9 @@ class Queue : public Drainable
     bool trySatisfyFunctional(PacketPtr pkt, Addr blk_addr)
     {
         pkt->pushLabel(label);
-        for (const auto& entry : allocatedList) {
+        for (QueueEntry *e = indexBuckets[indexBucket(blk_addr)]; e;
+             e = e->indexNext) {
+            Entry *entry = static_cast<Entry*>(e);
             if (entry->blkAddr == blk_addr && entry->trySatisfyFunctional(pkt)) {
                 pkt->popLabel();
                 return true;
@@ -198,12 +247,26 @@ class Queue : public Drainable
      */
     Entry* findPending(Addr blk_addr, bool is_secure) const
     {
-        for (const auto& entry : readyList) {
-            if (entry->blkAddr == blk_addr && entry->isSecure == is_secure) {
-                return entry;
+        Entry *match = nullptr;
+        for (QueueEntry *e = indexBuckets[indexBucket(blk_addr)]; e;
+             e = e->indexNext) {
+            if (e->inService || e->blkAddr != blk_addr ||
+                e->isSecure != is_secure) {
+                continue;
             }
+            if (match) {
+                // Several ready entries for the same block are rare;
+                // fall back to the readyList to find the earliest.
+                for (const auto& entry : readyList) {
+                    if (entry->blkAddr == blk_addr &&
+                        entry->isSecure == is_secure) {
+                        return entry;
+                    }
+                }
+            }
+            match = static_cast<Entry*>(e);
         }
-        return nullptr;
+        return match;
     }
 
     /**
@@ -231,8 +294,8 @@ class Queue : public Drainable
      */
     void deallocate(Entry *entry)
     {
-        allocatedList.erase(entry->allocIter);
-        freeList.push_front(entry);
+        removeFromIndex(entry);
+        freeList.splice(freeList.begin(), allocatedList, entry->allocIter);
         allocated--;
         if (entry->inService) {
             _numInService--;
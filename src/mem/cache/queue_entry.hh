@@ -75,6 +75,9 @@ class QueueEntry : public Packet::SenderState
     /** True if the entry is uncacheable */
     bool _isUncacheable;
 
+    /** Next entry in the same block address index bucket */
+    QueueEntry *indexNext;
+
   public:
 
     /** True if the entry has been sent downstream. */
@@ -92,7 +95,7 @@ class QueueEntry : public Packet::SenderState
     /** True if the entry targets the secure memory space. */
     bool isSecure;
 
-    QueueEntry() : readyTime(0), _isUncacheable(false),
+    QueueEntry() : readyTime(0), _isUncacheable(false), indexNext(nullptr),
                    inService(false), order(0), blkAddr(0), blkSize(0),
                    isSecure(false)
     {}
@@ -50,11 +50,13 @@
 #include <string>
 
 #include "base/intmath.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
 
 BaseSetAssoc::BaseSetAssoc(const Params *p)
     :BaseTags(p), allocAssoc(p->assoc), blks(p->size / p->block_size),
      sequentialAccess(p->sequential_access),
-     replacementPolicy(p->replacement_policy)
+     replacementPolicy(p->replacement_policy), assoc(p->assoc),
+     setAssocIndexing(dynamic_cast<const SetAssociative*>(indexingPolicy))
 {
     // Check parameters
     if (blkSize < 4 || !isPowerOf2(blkSize)) {
@@ -68,6 +70,9 @@ BaseSetAssoc::tagsInit(BaseCache* cache)
     // Set parent cache
     setCache(cache);
 
+    if (setAssocIndexing)
+        tagArray.init(numBlocks / assoc, assoc);
+
     // Initialize all blocks
     for (unsigned blk_index = 0; blk_index < numBlocks; blk_index++) {
         // Locate next cache block
@@ -89,6 +94,9 @@ BaseSetAssoc::invalidate(CacheBlk *blk)
 {
     BaseTags::invalidate(blk);
 
+    if (setAssocIndexing)
+        tagArray.invalidate(blk->getSet(), blk->getWay());
+
     // Decrease the number of tags in use
     tagsInUse--;
 
@@ -96,6 +104,29 @@ BaseSetAssoc::invalidate(CacheBlk *blk)
     replacementPolicy->invalidate(blk->replacementData);
 }
 
+CacheBlk*
+BaseSetAssoc::findBlock(Addr addr, bool is_secure) const
+{
+    if (!setAssocIndexing)
+        return BaseTags::findBlock(addr, is_secure);
+
+    const uint32_t set = setAssocIndexing->extractSet(addr);
+    const Addr tag = extractTag(addr);
+
+    // Blocks are inserted before they are made valid, so a matching tag
+    // alone is not enough
+    for (uint32_t way = tagArray.find(set, tag, is_secure); way < assoc;
+         way = tagArray.find(set, tag, is_secure, way + 1)) {
+        CacheBlk *blk = static_cast<CacheBlk*>(
+            indexingPolicy->getEntry(set, way));
+        if (blk->isValid())
+            return blk;
+    }
+
+    // Did not find block
+    return nullptr;
+}
+
 BaseSetAssoc *
 BaseSetAssocParams::create()
 {
@@ -60,8 +60,11 @@
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/cache/tags/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
+#include "mem/cache/tags/tag_array.hh"
 #include "params/BaseSetAssoc.hh"
 
+class SetAssociative;
+
 /**
  * A basic cache tag store.
  * @sa  \ref gem5MemorySystem "gem5 Memory System"
@@ -84,6 +87,18 @@ class BaseSetAssoc : public BaseTags
     /** Replacement policy */
     BaseReplacementPolicy *replacementPolicy;
 
+    /** The associativity of the cache. */
+    const unsigned assoc;
+
+    /**
+     * The indexing policy if it is a plain set associative one, in which
+     * case lookups use the packed tags. Null otherwise.
+     */
+    const SetAssociative *setAssocIndexing;
+
+    /** Packed copy of the block tags, only used with setAssocIndexing. */
+    TagArray tagArray;
+
   public:
     /** Convenience typedef. */
      typedef BaseSetAssocParams Params;
@@ -113,6 +128,15 @@ class BaseSetAssoc : public BaseTags
      */
     void invalidate(CacheBlk *blk) override;
 
+    /**
+     * Find a block using the packed tags if possible.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block if found.
+     */
+    CacheBlk *findBlock(Addr addr, bool is_secure) const override;
+
     /**
      * Access block and update replacement data. May not succeed, in which case
      * nullptr is returned. This has all the implications of a cache
@@ -177,7 +201,7 @@ class BaseSetAssoc : public BaseTags
                          std::vector<CacheBlk*>& evict_blks) const override
     {
         // Get possible entries to be victimized
-        const std::vector<ReplaceableEntry*> entries =
+        const std::vector<ReplaceableEntry*>& entries =
             indexingPolicy->getPossibleEntries(addr);
 
         // Choose replacement victim from replacement candidates
@@ -206,6 +230,9 @@ class BaseSetAssoc : public BaseTags
         // Insert block
         BaseTags::insertBlock(addr, is_secure, src_master_ID, task_ID, blk);
 
+        if (setAssocIndexing)
+            tagArray.insert(blk->getSet(), blk->getWay(), blk->tag, is_secure);
+
         // Increment tag counter
         tagsInUse++;
 
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a packed tag array for set associative tag stores.
+ */
+
+#ifndef __MEM_CACHE_TAGS_TAG_ARRAY_HH__
+#define __MEM_CACHE_TAGS_TAG_ARRAY_HH__
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "base/types.hh"
+
+/**
+ * Structure-of-arrays copy of the tags of a set associative tag store.
+ *
+ * The tag and secure bit of every way of a set are packed into one
+ * 64-bit key, and the keys of a set are stored contiguously, padded to
+ * a multiple of the vector width. A lookup compares a whole chunk of
+ * ways at a time without touching the cache blocks themselves. The
+ * owning tag store must update the array whenever a block is inserted
+ * or invalidated.
+ */
+class TagArray
+{
+  private:
+    /** Ways compared at once. */
+    static const unsigned lanes = 4;
+
+    typedef uint64_t Lanes __attribute__((vector_size(lanes * 8)));
+
+    /** Key of a way that holds no block; never matches a real key. */
+    static const uint64_t invalidKey = ~uint64_t(0);
+
+    uint32_t assoc;
+
+    /** Distance between the first keys of consecutive sets. */
+    uint32_t stride;
+
+    std::vector<uint64_t> keys;
+
+    static uint64_t
+    makeKey(Addr tag, bool is_secure)
+    {
+        return (tag << 1) | is_secure;
+    }
+
+  public:
+    TagArray() : assoc(0), stride(0) {}
+
+    void
+    init(uint32_t num_sets, uint32_t _assoc)
+    {
+        assoc = _assoc;
+        stride = (assoc + lanes - 1) / lanes * lanes;
+        // Pass a copy, assign() would bind the constant to a reference
+        keys.assign(uint64_t(num_sets) * stride, uint64_t(invalidKey));
+    }
+
+    /** Record the tag of a block inserted into a way. */
+    void
+    insert(uint32_t set, uint32_t way, Addr tag, bool is_secure)
+    {
+        keys[set * stride + way] = makeKey(tag, is_secure);
+    }
+
+    /** Forget the tag of a way. */
+    void
+    invalidate(uint32_t set, uint32_t way)
+    {
+        keys[set * stride + way] = invalidKey;
+    }
+
+    /**
+     * Find the first way at or after a given way whose tag matches.
+     *
+     * @param set The set to search.
+     * @param tag The tag to look for.
+     * @param is_secure Whether the block is in secure space.
+     * @param from The first way to consider.
+     * @return The matching way, or the associativity if there is none.
+     */
+    uint32_t
+    find(uint32_t set, Addr tag, bool is_secure, uint32_t from = 0) const
+    {
+        const uint64_t key = makeKey(tag, is_secure);
+        const Lanes key_lanes = { key, key, key, key };
+        const uint64_t *row = &keys[set * stride];
+
+        for (uint32_t base = from - from % lanes; base < stride;
+             base += lanes) {
+            Lanes chunk;
+            std::memcpy(&chunk, row + base, sizeof(chunk));
+            const auto eq = chunk == key_lanes;
+            if (eq[0] | eq[1] | eq[2] | eq[3]) {
+                for (unsigned lane = 0; lane < lanes; lane++) {
+                    if (eq[lane] && base + lane >= from)
+                        return base + lane;
+                }
+            }
+        }
+
+        return assoc;
+    }
+};
+
+#endif //__MEM_CACHE_TAGS_TAG_ARRAY_HH__
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "mem/cache/tags/tag_array.hh"
+
+TEST(TagArrayTest, InsertAndLookup)
+{
+    TagArray tags;
+    tags.init(4, 8);
+
+    tags.insert(1, 3, 0x1234, false);
+    tags.insert(1, 6, 0x5678, false);
+
+    EXPECT_EQ(tags.find(1, 0x1234, false), 3);
+    EXPECT_EQ(tags.find(1, 0x5678, false), 6);
+
+    // Other sets and tags miss, reported as the associativity
+    EXPECT_EQ(tags.find(0, 0x1234, false), 8);
+    EXPECT_EQ(tags.find(2, 0x5678, false), 8);
+    EXPECT_EQ(tags.find(1, 0x9999, false), 8);
+}
+
+TEST(TagArrayTest, SecureBitIsPartOfTheKey)
+{
+    TagArray tags;
+    tags.init(2, 4);
+
+    tags.insert(0, 0, 0x40, true);
+    tags.insert(0, 2, 0x40, false);
+
+    EXPECT_EQ(tags.find(0, 0x40, true), 0);
+    EXPECT_EQ(tags.find(0, 0x40, false), 2);
+}
+
+TEST(TagArrayTest, FindFromWay)
+{
+    // An associativity that is not a multiple of the vector width
+    TagArray tags;
+    tags.init(2, 6);
+
+    // A tag may be present in several ways while a block is being
+    // replaced, find() has to report each of them in turn.
+    tags.insert(1, 1, 0xab, false);
+    tags.insert(1, 5, 0xab, false);
+
+    EXPECT_EQ(tags.find(1, 0xab, false), 1);
+    EXPECT_EQ(tags.find(1, 0xab, false, 2), 5);
+    EXPECT_EQ(tags.find(1, 0xab, false, 5), 5);
+    EXPECT_EQ(tags.find(1, 0xab, false, 6), 6);
+}
+
+TEST(TagArrayTest, Invalidate)
+{
+    TagArray tags;
+    tags.init(2, 4);
+
+    tags.insert(0, 1, 0x10, false);
+    tags.invalidate(0, 1);
+    EXPECT_EQ(tags.find(0, 0x10, false), 4);
+
+    // Invalidating one way leaves the others alone
+    tags.insert(0, 0, 0x20, false);
+    tags.insert(0, 3, 0x30, false);
+    tags.invalidate(0, 0);
+    EXPECT_EQ(tags.find(0, 0x20, false), 4);
+    EXPECT_EQ(tags.find(0, 0x30, false), 3);
+}
+
+TEST(TagArrayTest, ReplaceVictim)
+{
+    TagArray tags;
+    tags.init(1, 16);
+    for (uint32_t way = 0; way < 16; way++)
+        tags.insert(0, way, 0x100 + way, false);
+
+    // Evict way 9 and reuse it for a new block, as BaseSetAssoc does
+    // with the victim chosen by the replacement policy.
+    tags.invalidate(0, 9);
+    tags.insert(0, 9, 0x500, false);
+
+    EXPECT_EQ(tags.find(0, 0x109, false), 16);
+    EXPECT_EQ(tags.find(0, 0x500, false), 9);
+    for (uint32_t way = 0; way < 16; way++) {
+        if (way != 9) {
+            EXPECT_EQ(tags.find(0, 0x100 + way, false), way);
+        }
+    }
+}
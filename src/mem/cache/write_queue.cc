@@ -64,10 +64,11 @@ WriteQueue::allocate(Addr blk_addr, unsigned blk_size, PacketPtr pkt,
     assert(!freeList.empty());
     WriteQueueEntry *entry = freeList.front();
     assert(entry->getNumTargets() == 0);
-    freeList.pop_front();
 
     entry->allocate(blk_addr, blk_size, pkt, when_ready, order);
-    entry->allocIter = allocatedList.insert(allocatedList.end(), entry);
+    entry->allocIter = freeList.begin();
+    allocatedList.splice(allocatedList.end(), freeList, freeList.begin());
+    addToIndex(entry);
     entry->readyIter = addToReadyList(entry);
 
     allocated += 1;
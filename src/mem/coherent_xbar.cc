@@ -621,6 +621,10 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID slave_port_id)
     // determine how long to be crossbar layer is busy
     Tick packetFinishTime = clockEdge(Cycles(1)) + pkt->payloadDelay;
 
+    // remove the request from the routing table before forwarding,
+    // as sending may reach back into the crossbar and move entries
+    routeTo.erase(route_lookup);
+
     // forward it either as a snoop response or a normal response
     if (forwardAsSnoop) {
         // this is a snoop response to a snoop request we forwarded,
@@ -671,9 +675,6 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID slave_port_id)
         respLayers[dest_port_id]->succeededTiming(packetFinishTime);
     }
 
-    // remove the request from the routing table
-    routeTo.erase(route_lookup);
-
     // stats updates
     transDist[pkt_cmd]++;
     snoops++;
@@ -720,8 +721,19 @@ CoherentXBar::recvReqRetry(PortID master_port_id)
     reqLayers[master_port_id]->recvRetry();
 }
 
+bool
+CoherentXBar::onlySnooper(PortID slave_port_id) const
+{
+    for (const auto& p: snoopPorts) {
+        if (p != slavePorts[slave_port_id])
+            return false;
+    }
+    return true;
+}
+
 Tick
-CoherentXBar::recvAtomic(PacketPtr pkt, PortID slave_port_id)
+CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID slave_port_id,
+                                    MemBackdoor *backdoor)
 {
     DPRINTF(CoherentXBar, "%s: src %s packet %s\n", __func__,
             slavePorts[slave_port_id]->name(), pkt->print());
@@ -799,8 +811,19 @@ CoherentXBar::recvAtomic(PacketPtr pkt, PortID slave_port_id)
                 pkt->clearWriteThrough();
             }
 
-            // forward the request to the appropriate destination
-            response_latency = masterPorts[master_port_id]->sendAtomic(pkt);
+            // forward the request to the appropriate destination,
+            // and only ask for a backdoor if nobody but the requestor
+            // could observe the accesses made through it, as they
+            // are not snooped
+            if (backdoor &&
+                (!snoop_caches || onlySnooper(slave_port_id))) {
+                response_latency =
+                    masterPorts[master_port_id]->sendAtomicBackdoor(
+                        pkt, *backdoor);
+            } else {
+                response_latency =
+                    masterPorts[master_port_id]->sendAtomic(pkt);
+            }
         } else {
             // if it does not need a response we sink the packet above
             assert(pkt->needsResponse());
@@ -51,9 +51,9 @@
 #ifndef __MEM_COHERENT_XBAR_HH__
 #define __MEM_COHERENT_XBAR_HH__
 
-#include <unordered_map>
 #include <unordered_set>
 
+#include "base/flat_hash_map.hh"
 #include "mem/snoop_filter.hh"
 #include "mem/xbar.hh"
 #include "params/CoherentXBar.hh"
@@ -126,6 +126,13 @@ class CoherentXBar : public BaseXBar
         virtual Tick recvAtomic(PacketPtr pkt)
         { return xbar.recvAtomic(pkt, id); }
 
+        /**
+         * When receiving an atomic request asking for a backdoor,
+         * pass it to the crossbar.
+         */
+        virtual Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+        { return xbar.recvAtomicBackdoor(pkt, id, &backdoor); }
+
         /**
          * When receiving a functional request, pass it to the crossbar.
          */
@@ -198,6 +205,10 @@ class CoherentXBar : public BaseXBar
         virtual void recvRangeChange()
         { xbar.recvRangeChange(id); }
 
+        /** When a slave revokes backdoors, pass it to the crossbar. */
+        virtual void recvBackdoorInvalidate(const AddrRange &range)
+        { xbar.recvBackdoorInvalidate(range); }
+
         /** When reciving a retry from the peer port (at id),
             pass it to the crossbar. */
         virtual void recvReqRetry()
@@ -268,7 +279,7 @@ class CoherentXBar : public BaseXBar
      * snoop responses from so we can determine when we received all
      * snoop responses and if any of the agents satisfied the request.
      */
-    std::unordered_map<PacketId, PacketPtr> outstandingCMO;
+    FlatHashMap<PacketId, PacketPtr> outstandingCMO;
 
     /**
      * Keep a pointer to the system to be allow to querying memory system
@@ -341,7 +352,20 @@ class CoherentXBar : public BaseXBar
 
     /** Function called by the port when the crossbar is recieving a Atomic
       transaction.*/
-    Tick recvAtomic(PacketPtr pkt, PortID slave_port_id);
+    Tick recvAtomic(PacketPtr pkt, PortID slave_port_id)
+    { return recvAtomicBackdoor(pkt, slave_port_id, nullptr); }
+
+    /** Function called by the port when the crossbar is recieving an
+        Atomic transaction that may return a backdoor. Pass a null
+        backdoor if none is wanted.*/
+    Tick recvAtomicBackdoor(PacketPtr pkt, PortID slave_port_id,
+                            MemBackdoor *backdoor);
+
+    /**
+     * Check if the given slave port is the only snooper, in which
+     * case nothing is lost by not snooping its requests.
+     */
+    bool onlySnooper(PortID slave_port_id) const;
 
     /** Function called by the port when the crossbar is recieving an
         atomic snoop transaction.*/
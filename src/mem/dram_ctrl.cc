@@ -106,8 +106,10 @@ DRAMCtrl::DRAMCtrl(const DRAMCtrlParams* p) :
 
     fatal_if(!isPowerOf2(burstSize), "DRAM burst size %d is not allowed, "
              "must be a power of two\n", burstSize);
-    readQueue.resize(p->qos_priorities);
-    writeQueue.resize(p->qos_priorities);
+    readQueue.resize(p->qos_priorities,
+                     DRAMPacketQueue(ranksPerChannel * banksPerRank));
+    writeQueue.resize(p->qos_priorities,
+                      DRAMPacketQueue(ranksPerChannel * banksPerRank));
 
 
     for (int i = 0; i < ranksPerChannel; i++) {
@@ -806,111 +808,28 @@ DRAMCtrl::chooseNext(DRAMPacketQueue& queue, Tick extra_col_delay)
 DRAMCtrl::DRAMPacketQueue::iterator
 DRAMCtrl::chooseNextFRFCFS(DRAMPacketQueue& queue, Tick extra_col_delay)
 {
-    // Only determine this if needed
-    vector<uint32_t> earliest_banks(ranksPerChannel, 0);
-
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
-    // can the PRE/ACT sequence be done without impacting utlization?
-    bool hidden_bank_prep = false;
-
-    // search for seamless row hits first, if no seamless row hit is
-    // found then determine if there are other packets that can be issued
-    // without incurring additional bus delay due to bank timing
-    // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
-
-    // remember if we found a row hit, not seamless, but bank prepped
-    // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
-
-    auto selected_pkt_it = queue.end();
-
     // time we need to issue a column command to be seamless
     const Tick min_col_at = std::max(nextBurstAt + extra_col_delay, curTick());
 
-    for (auto i = queue.begin(); i != queue.end() ; ++i) {
-        DRAMPacket* dram_pkt = *i;
-        const Bank& bank = dram_pkt->bankRef;
-        const Tick col_allowed_at = dram_pkt->isRead() ? bank.rdAllowedAt :
-                                                         bank.wrAllowedAt;
+    auto bank = [this](unsigned rank, unsigned bank) -> const Bank * {
+        return ranks[rank]->inRefIdleState() ?
+            &ranks[rank]->banks[bank] : nullptr;
+    };
+    auto min_bank_prep = [&]() { return minBankPrep(queue, min_col_at); };
 
-        DPRINTF(DRAM, "%s checking packet in bank %d\n",
-                __func__, dram_pkt->bankRef.bank);
-
-        // check if rank is not doing a refresh and thus is available, if not,
-        // jump to the next packet
-        if (dram_pkt->rankRef.inRefIdleState()) {
-
-            DPRINTF(DRAM,
-                    "%s bank %d - Rank %d available\n", __func__,
-                    dram_pkt->bankRef.bank, dram_pkt->rankRef.rank);
-
-            // check if it is a row hit
-            if (bank.openRow == dram_pkt->row) {
-                // no additional rank-to-rank or same bank-group
-                // delays, or we switched read/write and might as well
-                // go for the row hit
-                if (col_allowed_at <= min_col_at) {
-                    // FCFS within the hits, giving priority to
-                    // commands that can issue seamlessly, without
-                    // additional delay, such as same rank accesses
-                    // and/or different bank-group accesses
-                    DPRINTF(DRAM, "%s Seamless row buffer hit\n", __func__);
-                    selected_pkt_it = i;
-                    // no need to look through the remaining queue entries
-                    break;
-                } else if (!found_hidden_bank && !found_prepped_pkt) {
-                    // if we did not find a packet to a closed row that can
-                    // issue the bank commands without incurring delay, and
-                    // did not yet find a packet to a prepped row, remember
-                    // the current one
-                    selected_pkt_it = i;
-                    found_prepped_pkt = true;
-                    DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
-                }
-            } else if (!found_earliest_pkt) {
-                // if we have not initialised the bank status, do it
-                // now, and only once per scheduling decisions
-                if (!filled_earliest_banks) {
-                    // determine entries with earliest bank delay
-                    std::tie(earliest_banks, hidden_bank_prep) =
-                        minBankPrep(queue, min_col_at);
-                    filled_earliest_banks = true;
-                }
+    auto pkt_it = chooseFRFCFS(queue, ranksPerChannel, banksPerRank,
+                               bank, min_bank_prep, min_col_at);
 
-                // bank is amongst first available banks
-                // minBankPrep will give priority to packets that can
-                // issue seamlessly
-                if (bits(earliest_banks[dram_pkt->rank],
-                         dram_pkt->bank, dram_pkt->bank)) {
-                    found_earliest_pkt = true;
-                    found_hidden_bank = hidden_bank_prep;
-
-                    // give priority to packets that can issue
-                    // bank commands 'behind the scenes'
-                    // any additional delay if any will be due to
-                    // col-to-col command requirements
-                    if (hidden_bank_prep || !found_prepped_pkt)
-                        selected_pkt_it = i;
-                }
-            }
-        } else {
-            DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
-                    dram_pkt->bankRef.bank, dram_pkt->rankRef.rank);
-        }
-    }
-
-    if (selected_pkt_it == queue.end()) {
+    if (pkt_it == queue.end()) {
         DPRINTF(DRAM, "%s no available ranks found\n", __func__);
+    } else {
+        DPRINTF(DRAM, "%s chose %s to bank %d row %d, open row %d\n",
+                __func__, (*pkt_it)->isRead() ? "read" : "write",
+                (*pkt_it)->bankId, (*pkt_it)->row,
+                (*pkt_it)->bankRef.openRow);
     }
 
-    return selected_pkt_it;
+    return pkt_it;
 }
 
 void
@@ -1233,26 +1152,23 @@ DRAMCtrl::doDRAMAccess(DRAMPacket* dram_pkt)
                 dram_pkt->isRead() ? readQueue : writeQueue;
 
         for (uint8_t i = 0; i < numPriorities(); ++i) {
-            auto p = queue[i].begin();
-            // keep on looking until we find a hit or reach the end of the queue
-            // 1) if a hit is found, then both open and close adaptive policies keep
-            // the page open
-            // 2) if no hit is found, got_bank_conflict is set to true if a bank
-            // conflict request is waiting in the queue
+            // 1) if a hit is found, then both open and close adaptive
+            // policies keep the page open
+            // 2) if no hit is found, got_bank_conflict is set to true if a
+            // bank conflict request is waiting in the queue
             // 3) make sure we are not considering the packet that we are
-            // currently dealing with
-            while (!got_more_hits && p != queue[i].end()) {
-                if (dram_pkt != (*p)) {
-                    bool same_rank_bank = (dram_pkt->rank == (*p)->rank) &&
-                                          (dram_pkt->bank == (*p)->bank);
-
-                    bool same_row = dram_pkt->row == (*p)->row;
-                    got_more_hits |= same_rank_bank && same_row;
-                    got_bank_conflict |= same_rank_bank && !same_row;
-                }
-                ++p;
+            // currently dealing with, which is still queued
+            unsigned same_row = queue[i].rowSize(dram_pkt->bankId,
+                                                 dram_pkt->row);
+            unsigned same_bank = queue[i].bankSize(dram_pkt->bankId);
+            if (i == dram_pkt->qosValue()) {
+                --same_row;
+                --same_bank;
             }
 
+            got_more_hits |= same_row > 0;
+            got_bank_conflict |= same_bank > same_row;
+
             if (got_more_hits)
                 break;
         }
@@ -1652,23 +1568,19 @@ DRAMCtrl::minBankPrep(const DRAMPacketQueue& queue,
     // delay on the data bus
     bool hidden_bank_prep = false;
 
-    // determine if we have queued transactions targetting the
-    // bank in question
-    vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->rankRef.inRefIdleState())
-            got_waiting[p->bankId] = true;
-    }
-
     // Find command with optimal bank timing
     // Will prioritize commands that can issue seamlessly.
     for (int i = 0; i < ranksPerChannel; i++) {
+        // only consider transactions to ranks that are not refreshing
+        if (!ranks[i]->inRefIdleState())
+            continue;
+
         for (int j = 0; j < banksPerRank; j++) {
             uint16_t bank_id = i * banksPerRank + j;
 
             // if we have waiting requests for the bank, and it is
             // amongst the first available, update the mask
-            if (got_waiting[bank_id]) {
+            if (queue.bankSize(bank_id)) {
                 // make sure this rank is not currently refreshing.
                 assert(ranks[i]->inRefIdleState());
                 // simplistic approximation of when the bank can issue
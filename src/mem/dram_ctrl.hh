@@ -55,15 +55,18 @@
 #define __MEM_DRAM_CTRL_HH__
 
 #include <deque>
+#include <list>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
 #include "base/callback.hh"
+#include "base/pool_allocator.hh"
 #include "base/statistics.hh"
 #include "enums/AddrMap.hh"
 #include "enums/MemSched.hh"
 #include "enums/PageManage.hh"
+#include "mem/dram_indexed_queue.hh"
 #include "mem/drampower.hh"
 #include "mem/qos/mem_ctrl.hh"
 #include "mem/qport.hh"
@@ -627,6 +630,9 @@ class DRAMCtrl : public QoS::MemCtrl
         { }
     };
 
+    class DRAMPacket;
+    typedef DRAMIndexedQueue<DRAMPacket>::List DRAMPacketList;
+
     /**
      * A DRAM packet stores packets along with the timestamp of when
      * the packet entered the queue, and also the decoded address.
@@ -688,6 +694,16 @@ class DRAMCtrl : public QoS::MemCtrl
          */
         uint8_t _qosValue;
 
+        /** Position in the queue the packet is in */
+        DRAMPacketList::iterator queuePos;
+
+        /** Order of arrival in the queue the packet is in */
+        uint64_t queueSeq;
+
+        /** Neighbours in the queue amongst packets to the same row */
+        DRAMPacket *rowPrev;
+        DRAMPacket *rowNext;
+
         /**
          * Set the packet QoS value
          * (interface compatibility with Packet)
@@ -738,14 +754,30 @@ class DRAMCtrl : public QoS::MemCtrl
               _masterId(pkt->masterId()),
               read(is_read), rank(_rank), bank(_bank), row(_row),
               bankId(bank_id), addr(_addr), size(_size), burstHelper(NULL),
-              bankRef(bank_ref), rankRef(rank_ref), _qosValue(_pkt->qosValue())
+              bankRef(bank_ref), rankRef(rank_ref), _qosValue(_pkt->qosValue()),
+              queueSeq(0), rowPrev(nullptr), rowNext(nullptr)
         { }
 
+        static void *
+        operator new(size_t size)
+        {
+            if (size != sizeof(DRAMPacket))
+                return ::operator new(size);
+            return BlockPool<sizeof(DRAMPacket)>::allocate();
+        }
+
+        static void
+        operator delete(void *p, size_t size)
+        {
+            if (size != sizeof(DRAMPacket))
+                ::operator delete(p);
+            else
+                BlockPool<sizeof(DRAMPacket)>::release(p);
+        }
     };
 
-    // The DRAM packets are store in a multiple dequeue structure,
-    // based on their QoS priority
-    typedef std::deque<DRAMPacket*> DRAMPacketQueue;
+    /** Queue of DRAM packets indexed by bank and row */
+    typedef DRAMIndexedQueue<DRAMPacket> DRAMPacketQueue;
 
     /**
      * Bunch of things requires to setup "events" in gem5
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file
+ * Declaration of the bank and row indexed queue of the DRAM controller
+ * and of its FR-FCFS scheduling decision.
+ */
+
+#ifndef __MEM_DRAM_INDEXED_QUEUE_HH__
+#define __MEM_DRAM_INDEXED_QUEUE_HH__
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/pool_allocator.hh"
+#include "base/types.hh"
+
+/**
+ * A queue of DRAM packets in arrival order, also indexed by bank and
+ * row so that the scheduler can find the oldest row hit or row miss of
+ * a bank without walking the queue.
+ *
+ * Pkt has to provide the bankId and row it goes to, and the members
+ * the queue keeps its index in: queuePos, queueSeq, rowPrev and
+ * rowNext.
+ */
+template <class Pkt>
+class DRAMIndexedQueue
+{
+  public:
+    typedef std::list<Pkt*, PoolAllocator<Pkt*>> List;
+    typedef typename List::iterator iterator;
+    typedef typename List::const_iterator const_iterator;
+
+    /**
+     * @param num_banks Number of banks in all ranks of the channel
+     */
+    DRAMIndexedQueue(unsigned num_banks) : banks(num_banks), nextSeq(0)
+    { }
+
+    iterator begin() { return packets.begin(); }
+    iterator end() { return packets.end(); }
+    const_iterator begin() const { return packets.begin(); }
+    const_iterator end() const { return packets.end(); }
+    size_t size() const { return packets.size(); }
+    bool empty() const { return packets.empty(); }
+
+    void
+    push_back(Pkt *pkt)
+    {
+        pkt->queuePos = packets.insert(packets.end(), pkt);
+        pkt->queueSeq = nextSeq++;
+
+        BankQueue &bank = banks[pkt->bankId];
+        RowQueue &row = bank.rows[pkt->row];
+        pkt->rowPrev = row.tail;
+        pkt->rowNext = nullptr;
+        if (row.tail)
+            row.tail->rowNext = pkt;
+        else
+            row.head = pkt;
+        row.tail = pkt;
+        ++row.size;
+        ++bank.size;
+    }
+
+    /** Remove a packet, returning an iterator to the next one. */
+    iterator
+    erase(iterator it)
+    {
+        Pkt *pkt = *it;
+        BankQueue &bank = banks[pkt->bankId];
+        auto row_it = bank.rows.find(pkt->row);
+        assert(row_it != bank.rows.end());
+        RowQueue &row = row_it->second;
+
+        if (pkt->rowPrev)
+            pkt->rowPrev->rowNext = pkt->rowNext;
+        else
+            row.head = pkt->rowNext;
+        if (pkt->rowNext)
+            pkt->rowNext->rowPrev = pkt->rowPrev;
+        else
+            row.tail = pkt->rowPrev;
+        pkt->rowPrev = pkt->rowNext = nullptr;
+
+        if (--row.size == 0)
+            bank.rows.erase(row_it);
+        --bank.size;
+
+        return packets.erase(it);
+    }
+
+    /** Number of queued packets to a bank. */
+    unsigned bankSize(uint16_t bank_id) const
+    { return banks[bank_id].size; }
+
+    /** Number of queued packets to a row of a bank. */
+    unsigned
+    rowSize(uint16_t bank_id, uint32_t row) const
+    {
+        const RowMap &rows = banks[bank_id].rows;
+        auto row_it = rows.find(row);
+        return row_it == rows.end() ? 0 : row_it->second.size;
+    }
+
+    /** The oldest packet to a row of a bank, or end(). */
+    iterator
+    oldestInRow(uint16_t bank_id, uint32_t row)
+    {
+        const RowMap &rows = banks[bank_id].rows;
+        auto row_it = rows.find(row);
+        return row_it == rows.end() ? packets.end() :
+            row_it->second.head->queuePos;
+    }
+
+    /** The oldest packet to a bank not to the given row, or end(). */
+    iterator
+    oldestNotInRow(uint16_t bank_id, uint32_t row)
+    {
+        Pkt *oldest = nullptr;
+        for (const auto &r : banks[bank_id].rows) {
+            if (r.first != row &&
+                (!oldest || r.second.head->queueSeq < oldest->queueSeq)) {
+                oldest = r.second.head;
+            }
+        }
+        return oldest ? oldest->queuePos : packets.end();
+    }
+
+    /** Check if a packet arrived before another. */
+    static bool
+    older(const_iterator a, const_iterator b)
+    {
+        return (*a)->queueSeq < (*b)->queueSeq;
+    }
+
+  private:
+    /** Packets to one row, linked through the packets themselves */
+    struct RowQueue
+    {
+        Pkt *head = nullptr;
+        Pkt *tail = nullptr;
+        unsigned size = 0;
+    };
+
+    typedef std::unordered_map<
+        uint32_t, RowQueue, std::hash<uint32_t>, std::equal_to<uint32_t>,
+        PoolAllocator<std::pair<const uint32_t, RowQueue>>> RowMap;
+
+    struct BankQueue
+    {
+        /** Rows with queued packets */
+        RowMap rows;
+        unsigned size = 0;
+    };
+
+    List packets;
+    std::vector<BankQueue> banks;
+    uint64_t nextSeq;
+};
+
+/**
+ * Pick the packet an FR-FCFS scheduler issues next.
+ *
+ * This picks the same packet as walking the queue in order and
+ * stopping at the first seamless row hit, while remembering the first
+ * row hit, and the first row miss to one of the banks min_bank_prep
+ * deems earliest. Any of these is the oldest packet to its row, or to
+ * a row other than the open one, in its bank, so only the banks need
+ * to be looked at rather than the queue. The queue has to hold only
+ * reads or only writes, as the oldest hit stands for all hits to its
+ * row.
+ *
+ * @param queue Queued requests to consider
+ * @param ranks Number of ranks in the channel
+ * @param banks_per_rank Number of banks in a rank
+ * @param bank Called with a rank and bank index, returns a pointer to
+ *             the bank state (openRow, rdAllowedAt and wrAllowedAt) or
+ *             nullptr if the rank is refreshing
+ * @param min_bank_prep Returns the one-hot masks of the earliest banks
+ *                      of each rank and whether they can be prepared
+ *                      without delaying the data bus, only called if
+ *                      there is a row miss
+ * @param min_col_at Time of a seamless column command
+ * @return an iterator to the selected packet, else queue.end()
+ */
+template <class Queue, class BankFn, class BankPrepFn>
+typename Queue::iterator
+chooseFRFCFS(Queue &queue, unsigned ranks, unsigned banks_per_rank,
+             BankFn bank, BankPrepFn min_bank_prep, Tick min_col_at)
+{
+    // the oldest row hit that can issue seamlessly, and the oldest one
+    // that cannot
+    auto seamless_pkt_it = queue.end();
+    auto prepped_pkt_it = queue.end();
+
+    // are there any packets to a closed row in an available rank?
+    bool got_row_miss = false;
+
+    for (unsigned i = 0; i < ranks; i++) {
+        for (unsigned j = 0; j < banks_per_rank; j++) {
+            uint16_t bank_id = i * banks_per_rank + j;
+            unsigned bank_size = queue.bankSize(bank_id);
+            if (!bank_size)
+                continue;
+
+            // skip the rest of a rank that is doing a refresh
+            const auto *b = bank(i, j);
+            if (!b)
+                break;
+
+            unsigned hits = queue.rowSize(bank_id, b->openRow);
+            if (hits) {
+                auto hit_it = queue.oldestInRow(bank_id, b->openRow);
+                const Tick col_allowed_at = (*hit_it)->isRead() ?
+                    b->rdAllowedAt : b->wrAllowedAt;
+
+                // no additional rank-to-rank or same bank-group
+                // delays, or we switched read/write and might as well
+                // go for the row hit
+                auto &pkt_it = col_allowed_at <= min_col_at ?
+                    seamless_pkt_it : prepped_pkt_it;
+                if (pkt_it == queue.end() || Queue::older(hit_it, pkt_it))
+                    pkt_it = hit_it;
+            }
+
+            got_row_miss |= hits < bank_size;
+        }
+    }
+
+    // FCFS within the hits, giving priority to commands that can
+    // issue seamlessly, without additional delay, such as same rank
+    // accesses and/or different bank-group accesses
+    if (seamless_pkt_it != queue.end())
+        return seamless_pkt_it;
+
+    auto earliest_pkt_it = queue.end();
+    if (got_row_miss) {
+        // determine banks with the earliest bank delay, giving
+        // priority to those that can issue seamlessly
+        std::vector<uint32_t> earliest_banks;
+        bool hidden_bank_prep;
+        std::tie(earliest_banks, hidden_bank_prep) = min_bank_prep();
+
+        for (unsigned i = 0; i < ranks; i++) {
+            for (unsigned j = 0; j < banks_per_rank; j++) {
+                if (!bits(earliest_banks[i], j, j))
+                    continue;
+
+                uint16_t bank_id = i * banks_per_rank + j;
+                auto miss_it = queue.oldestNotInRow(bank_id,
+                                                    bank(i, j)->openRow);
+                if (miss_it != queue.end() &&
+                    (earliest_pkt_it == queue.end() ||
+                     Queue::older(miss_it, earliest_pkt_it))) {
+                    earliest_pkt_it = miss_it;
+                }
+            }
+        }
+
+        // give priority to packets that can issue bank commands
+        // 'behind the scenes', any additional delay if any will be
+        // due to col-to-col command requirements
+        if (earliest_pkt_it != queue.end() && hidden_bank_prep)
+            return earliest_pkt_it;
+    }
+
+    if (prepped_pkt_it != queue.end())
+        return prepped_pkt_it;
+
+    return earliest_pkt_it;
+}
+
+#endif // __MEM_DRAM_INDEXED_QUEUE_HH__
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "mem/dram_indexed_queue.hh"
+
+namespace {
+
+const unsigned numRanks = 2;
+const unsigned banksPerRank = 4;
+const unsigned numBanks = numRanks * banksPerRank;
+const uint32_t noRow = ~0U;
+
+struct TestPacket
+{
+    uint8_t rank;
+    uint8_t bank;
+    uint16_t bankId;
+    uint32_t row;
+    bool read;
+
+    DRAMIndexedQueue<TestPacket>::iterator queuePos;
+    uint64_t queueSeq;
+    TestPacket *rowPrev;
+    TestPacket *rowNext;
+
+    TestPacket(unsigned bank_id, uint32_t _row, bool is_read)
+        : rank(bank_id / banksPerRank), bank(bank_id % banksPerRank),
+          bankId(bank_id), row(_row), read(is_read), queueSeq(0),
+          rowPrev(nullptr), rowNext(nullptr)
+    {}
+
+    bool isRead() const { return read; }
+};
+
+typedef DRAMIndexedQueue<TestPacket> Queue;
+
+struct TestBank
+{
+    uint32_t openRow;
+    Tick rdAllowedAt;
+    Tick wrAllowedAt;
+};
+
+class DRAMIndexedQueueTest : public ::testing::Test
+{
+  protected:
+    DRAMIndexedQueueTest() : queue(numBanks), rng(1234) {}
+
+    ~DRAMIndexedQueueTest()
+    {
+        while (!queue.empty())
+            eraseAt(0);
+    }
+
+    unsigned
+    random(unsigned n)
+    {
+        return std::uniform_int_distribution<unsigned>(0, n - 1)(rng);
+    }
+
+    bool chance(double p) { return std::bernoulli_distribution(p)(rng); }
+
+    void
+    push(unsigned bank_id, uint32_t row, bool read = true)
+    {
+        queue.push_back(new TestPacket(bank_id, row, read));
+    }
+
+    void
+    eraseAt(unsigned idx)
+    {
+        auto it = queue.begin();
+        std::advance(it, idx);
+        TestPacket *pkt = *it;
+        queue.erase(it);
+        delete pkt;
+    }
+
+    Queue queue;
+    std::mt19937 rng;
+};
+
+} // anonymous namespace
+
+TEST_F(DRAMIndexedQueueTest, KeepsArrivalOrder)
+{
+    push(0, 1);
+    push(3, 2);
+    push(0, 1);
+    eraseAt(1);
+    push(5, 7);
+
+    std::vector<unsigned> banks;
+    for (auto pkt : queue)
+        banks.push_back(pkt->bankId);
+    EXPECT_EQ(banks, std::vector<unsigned>({0, 0, 5}));
+    EXPECT_TRUE(Queue::older(queue.begin(), std::next(queue.begin())));
+}
+
+TEST_F(DRAMIndexedQueueTest, IndexMatchesScan)
+{
+    for (int step = 0; step < 20000; step++) {
+        if (queue.empty() || (queue.size() < 32 && chance(0.55)))
+            push(random(numBanks), random(4), chance(0.5));
+        else
+            eraseAt(random(queue.size()));
+
+        unsigned bank_id = random(numBanks);
+        uint32_t row = random(4);
+
+        unsigned bank_size = 0, row_size = 0;
+        auto in_row = queue.end(), not_in_row = queue.end();
+        for (auto it = queue.begin(); it != queue.end(); ++it) {
+            if ((*it)->bankId != bank_id)
+                continue;
+            bank_size++;
+            if ((*it)->row == row) {
+                row_size++;
+                if (in_row == queue.end())
+                    in_row = it;
+            } else if (not_in_row == queue.end()) {
+                not_in_row = it;
+            }
+        }
+
+        ASSERT_EQ(queue.bankSize(bank_id), bank_size);
+        ASSERT_EQ(queue.rowSize(bank_id, row), row_size);
+        ASSERT_TRUE(queue.oldestInRow(bank_id, row) == in_row);
+        ASSERT_TRUE(queue.oldestNotInRow(bank_id, row) == not_in_row);
+    }
+}
+
+/**
+ * The FR-FCFS choice as DRAMCtrl made it by walking the queue in
+ * order, kept as the reference chooseFRFCFS has to agree with.
+ */
+static Queue::iterator
+scanFRFCFS(Queue &queue, const std::vector<bool> &rank_available,
+           const std::vector<TestBank> &banks,
+           const std::vector<uint32_t> &earliest_banks,
+           bool hidden_bank_prep, Tick min_col_at)
+{
+    bool found_hidden_bank = false;
+    bool found_prepped_pkt = false;
+    bool found_earliest_pkt = false;
+
+    auto selected_pkt_it = queue.end();
+
+    for (auto i = queue.begin(); i != queue.end(); ++i) {
+        const TestPacket *pkt = *i;
+        const TestBank &bank = banks[pkt->bankId];
+        const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
+                                                    bank.wrAllowedAt;
+
+        if (!rank_available[pkt->rank])
+            continue;
+
+        if (bank.openRow == pkt->row) {
+            if (col_allowed_at <= min_col_at) {
+                selected_pkt_it = i;
+                break;
+            } else if (!found_hidden_bank && !found_prepped_pkt) {
+                selected_pkt_it = i;
+                found_prepped_pkt = true;
+            }
+        } else if (!found_earliest_pkt) {
+            if (bits(earliest_banks[pkt->rank], pkt->bank, pkt->bank)) {
+                found_earliest_pkt = true;
+                found_hidden_bank = hidden_bank_prep;
+                if (hidden_bank_prep || !found_prepped_pkt)
+                    selected_pkt_it = i;
+            }
+        }
+    }
+
+    return selected_pkt_it;
+}
+
+TEST_F(DRAMIndexedQueueTest, FRFCFSMatchesScan)
+{
+    const Tick min_col_at = 1000;
+    unsigned calls = 0;
+
+    for (int trial = 0; trial < 50000; trial++) {
+        // DRAMCtrl keeps reads and writes in separate queues
+        unsigned n = 1 + random(12);
+        bool read = chance(0.5);
+        for (unsigned i = 0; i < n; i++)
+            push(random(numBanks), random(3), read);
+
+        std::vector<bool> rank_available(numRanks);
+        for (unsigned i = 0; i < numRanks; i++)
+            rank_available[i] = chance(0.8);
+
+        std::vector<TestBank> banks(numBanks);
+        for (auto &bank : banks) {
+            unsigned row = random(4);
+            bank.openRow = row == 3 ? noRow : row;
+            bank.rdAllowedAt = chance(0.3) ? min_col_at : min_col_at + 1;
+            bank.wrAllowedAt = chance(0.3) ? min_col_at - 1 : min_col_at + 1;
+        }
+
+        // Like minBankPrep, only pick banks of available ranks with
+        // waiting packets, and at least one of them.
+        std::vector<uint32_t> earliest_banks(numRanks, 0);
+        std::vector<unsigned> waiting;
+        for (unsigned b = 0; b < numBanks; b++) {
+            if (queue.bankSize(b) && rank_available[b / banksPerRank])
+                waiting.push_back(b);
+        }
+        for (unsigned b : waiting) {
+            if (chance(0.5))
+                replaceBits(earliest_banks[b / banksPerRank],
+                            b % banksPerRank, b % banksPerRank, 1);
+        }
+        if (!waiting.empty() &&
+            std::all_of(earliest_banks.begin(), earliest_banks.end(),
+                        [](uint32_t mask) { return mask == 0; })) {
+            unsigned b = waiting[random(waiting.size())];
+            replaceBits(earliest_banks[b / banksPerRank],
+                        b % banksPerRank, b % banksPerRank, 1);
+        }
+        bool hidden_bank_prep = chance(0.5);
+
+        auto bank = [&](unsigned rank, unsigned bank) -> const TestBank * {
+            return rank_available[rank] ?
+                &banks[rank * banksPerRank + bank] : nullptr;
+        };
+        auto min_bank_prep = [&]() {
+            calls++;
+            return std::make_pair(earliest_banks, hidden_bank_prep);
+        };
+
+        auto expected = scanFRFCFS(queue, rank_available, banks,
+                                   earliest_banks, hidden_bank_prep,
+                                   min_col_at);
+        auto chosen = chooseFRFCFS(queue, numRanks, banksPerRank, bank,
+                                   min_bank_prep, min_col_at);
+        ASSERT_TRUE(chosen == expected) << "trial " << trial;
+
+        while (!queue.empty())
+            eraseAt(0);
+    }
+
+    // The row misses have to have been looked at in some trials
+    EXPECT_GT(calls, 0);
+}
@@ -244,7 +244,8 @@ NoncoherentXBar::recvReqRetry(PortID master_port_id)
 }
 
 Tick
-NoncoherentXBar::recvAtomic(PacketPtr pkt, PortID slave_port_id)
+NoncoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID slave_port_id,
+                                       MemBackdoor *backdoor)
 {
     DPRINTF(NoncoherentXBar, "recvAtomic: packet src %s addr 0x%x cmd %s\n",
             slavePorts[slave_port_id]->name(), pkt->getAddr(),
@@ -262,8 +263,12 @@ NoncoherentXBar::recvAtomic(PacketPtr pkt, PortID slave_port_id)
     pktSize[slave_port_id][master_port_id] += pkt_size;
     transDist[pkt_cmd]++;
 
-    // forward the request to the appropriate destination
-    Tick response_latency = masterPorts[master_port_id]->sendAtomic(pkt);
+    // forward the request to the appropriate destination, the
+    // crossbar adds no latency in atomic mode and can thus pass on
+    // any backdoor as is
+    Tick response_latency = backdoor ?
+        masterPorts[master_port_id]->sendAtomicBackdoor(pkt, *backdoor) :
+        masterPorts[master_port_id]->sendAtomic(pkt);
 
     // add the response data
     if (pkt->isResponse()) {
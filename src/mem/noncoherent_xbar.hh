@@ -116,6 +116,9 @@ class NoncoherentXBar : public BaseXBar
         virtual Tick recvAtomic(PacketPtr pkt)
         { return xbar.recvAtomic(pkt, id); }
 
+        virtual Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+        { return xbar.recvAtomicBackdoor(pkt, id, &backdoor); }
+
         /**
          * When receiving a functional request, pass it to the crossbar.
          */
@@ -162,6 +165,9 @@ class NoncoherentXBar : public BaseXBar
         virtual void recvRangeChange()
         { xbar.recvRangeChange(id); }
 
+        virtual void recvBackdoorInvalidate(const AddrRange &range)
+        { xbar.recvBackdoorInvalidate(range); }
+
         /** When reciving a retry from the peer port (at id),
             pass it to the crossbar. */
         virtual void recvReqRetry()
@@ -183,7 +189,14 @@ class NoncoherentXBar : public BaseXBar
 
     /** Function called by the port when the crossbar is recieving a Atomic
       transaction.*/
-    Tick recvAtomic(PacketPtr pkt, PortID slave_port_id);
+    Tick recvAtomic(PacketPtr pkt, PortID slave_port_id)
+    { return recvAtomicBackdoor(pkt, slave_port_id, nullptr); }
+
+    /** Function called by the port when the crossbar is recieving an
+        Atomic transaction that may return a backdoor. Pass a null
+        backdoor if none is wanted.*/
+    Tick recvAtomicBackdoor(PacketPtr pkt, PortID slave_port_id,
+                            MemBackdoor *backdoor);
 
     /** Function called by the port when the crossbar is recieving a Functional
         transaction.*/
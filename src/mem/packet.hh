@@ -61,6 +61,7 @@
 #include "base/compiler.hh"
 #include "base/flags.hh"
 #include "base/logging.hh"
+#include "base/pool_allocator.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
 #include "config/the_isa.hh"
@@ -301,6 +302,9 @@ class Packet : public Printable
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The dynamic data was taken from the pool of small
+        /// payloads and is returned there instead of being deleted.
+        POOLED_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -770,6 +774,27 @@ class Packet : public Printable
         cmd = MemCmd::ReadReq;
     }
 
+    /** Payloads up to this size are taken from a per-thread pool. */
+    static const unsigned pooledDataSize = 64;
+
+    /** Packets are allocated from a per-thread pool. */
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(Packet))
+            return ::operator new(size);
+        return BlockPool<sizeof(Packet)>::allocate();
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size != sizeof(Packet))
+            ::operator delete(p);
+        else
+            BlockPool<sizeof(Packet)>::release(p);
+    }
+
     /**
      * Constructor. Note that a Request object must be constructed
      * first, but the Requests's physical address and size fields need
@@ -1166,10 +1191,12 @@ class Packet : public Printable
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(POOLED_DATA))
+            BlockPool<pooledDataSize>::release(data);
+        else if (flags.isSet(DYNAMIC_DATA))
             delete [] data;
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(STATIC_DATA|DYNAMIC_DATA|POOLED_DATA);
         data = NULL;
     }
 
@@ -1182,7 +1209,13 @@ class Packet : public Printable
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
             flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= pooledDataSize) {
+                flags.set(POOLED_DATA);
+                data = static_cast<PacketDataPtr>(
+                    BlockPool<pooledDataSize>::allocate());
+            } else {
+                data = new uint8_t[getSize()];
+            }
         }
     }
 
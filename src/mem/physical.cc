@@ -46,12 +46,17 @@
 #include <unistd.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <thread>
 
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
 #include "debug/Checkpoint.hh"
@@ -71,6 +76,122 @@
 
 using namespace std;
 
+namespace {
+
+/**
+ * Memory checkpoints are written in chunks of this many bytes. Each
+ * chunk is compressed on its own, so they can be compressed and
+ * decompressed in parallel, and chunks of zeros are left out.
+ */
+const uint64_t chunkSize = 64 * 1024;
+
+/** Header of a chunked memory checkpoint file */
+struct ChunkFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t chunkSize;
+    uint64_t rangeSize;
+    /** Offset of the array of ChunkEntries, after the chunk data */
+    uint64_t indexOffset;
+};
+
+const char chunkFileMagic[8] = "gem5pmc";
+const uint32_t chunkFileVersion = 1;
+
+/** Where the data of a chunk is in the file */
+struct ChunkEntry
+{
+    enum Kind : uint32_t {
+        /** All zeros, not in the file */
+        Zero,
+        /** Did not compress, stored as is */
+        Raw,
+        /** zlib compressed */
+        Deflate,
+    };
+
+    uint64_t offset;
+    uint32_t size;
+    uint32_t kind;
+};
+
+/** Chunks each checkpointing thread compresses before they are written */
+const unsigned chunksPerThread = 8;
+
+unsigned
+checkpointThreads()
+{
+    return max(1u, thread::hardware_concurrency());
+}
+
+/** Call work(i) for every i in [0, n) from a few threads */
+template <typename F>
+void
+parallelFor(uint64_t n, F work)
+{
+    const unsigned threads = min<uint64_t>(n, checkpointThreads());
+    atomic<uint64_t> next(0);
+    auto worker = [&]() {
+        for (uint64_t i = next++; i < n; i = next++)
+            work(i);
+    };
+
+    vector<thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (auto &t : pool)
+        t.join();
+}
+
+bool
+isZero(const uint8_t *data, uint64_t size)
+{
+    // Chunks are a multiple of the word size, as are memory ranges
+    const uint64_t *words = reinterpret_cast<const uint64_t *>(data);
+    for (uint64_t i = 0; i < size / sizeof(uint64_t); ++i) {
+        if (words[i])
+            return false;
+    }
+    return true;
+}
+
+void
+writeAll(int fd, const void *data, uint64_t size, const string &filename)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    while (size) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            fatal("Write failed on physical memory checkpoint file '%s'\n",
+                  filename);
+        p += n;
+        size -= n;
+    }
+}
+
+bool
+readAll(int fd, void *data, uint64_t size, uint64_t offset)
+{
+    uint8_t *p = static_cast<uint8_t *>(data);
+    while (size) {
+        ssize_t n = pread(fd, p, size, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= n;
+        offset += n;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
 PhysicalMemory::PhysicalMemory(const string& _name,
                                const vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve) :
@@ -339,35 +460,89 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     SERIALIZE_SCALAR(store_id);
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
+    // Tells the chunked format from the old gzip stream
+    uint64_t chunk_size = chunkSize;
+    SERIALIZE_SCALAR(chunk_size);
 
     // write memory file
     string filepath = CheckpointIn::dir() + "/" + filename.c_str();
-    gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
-    if (compressed_mem == NULL)
+    int fd = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0664);
+    if (fd < 0)
         fatal("Can't open physical memory checkpoint file '%s'\n",
               filename);
 
-    uint64_t pass_size = 0;
+    ChunkFileHeader header;
+    memcpy(header.magic, chunkFileMagic, sizeof(header.magic));
+    header.version = chunkFileVersion;
+    header.chunkSize = chunkSize;
+    header.rangeSize = range_size;
+    header.indexOffset = 0;
+    writeAll(fd, &header, sizeof(header), filename);
+    uint64_t offset = sizeof(header);
+
+    const uint64_t chunks = divCeil(range_size, chunkSize);
+    vector<ChunkEntry> index(chunks);
+
+    // Compress a batch of chunks in parallel, then write them in
+    // order, which bounds the memory used for the compressed data
+    const uint64_t batch = checkpointThreads() * chunksPerThread;
+    vector<vector<uint8_t>> buffers(min(batch, chunks));
+    uint64_t zero_chunks = 0;
+    for (uint64_t first = 0; first < chunks; first += batch) {
+        const uint64_t count = min(batch, chunks - first);
+
+        parallelFor(count, [&](uint64_t i) {
+            const uint64_t start = (first + i) * chunkSize;
+            const uint64_t size = min(chunkSize, range_size - start);
+            ChunkEntry &entry = index[first + i];
+            entry.size = size;
+
+            if (isZero(pmem + start, size)) {
+                entry.kind = ChunkEntry::Zero;
+                entry.size = 0;
+                return;
+            }
 
-    // gzwrite fails if (int)len < 0 (gzwrite returns int)
-    for (uint64_t written = 0; written < range.size();
-         written += pass_size) {
-        pass_size = (uint64_t)INT_MAX < (range.size() - written) ?
-            (uint64_t)INT_MAX : (range.size() - written);
+            vector<uint8_t> &buffer = buffers[i];
+            uLongf compressed = compressBound(size);
+            buffer.resize(compressed);
+            if (compress2(buffer.data(), &compressed, pmem + start, size,
+                          Z_BEST_SPEED) == Z_OK && compressed < size) {
+                entry.kind = ChunkEntry::Deflate;
+                entry.size = compressed;
+            } else {
+                entry.kind = ChunkEntry::Raw;
+            }
+        });
+
+        for (uint64_t i = 0; i < count; ++i) {
+            ChunkEntry &entry = index[first + i];
+            entry.offset = offset;
+            if (entry.kind == ChunkEntry::Zero) {
+                zero_chunks++;
+                continue;
+            }
 
-        if (gzwrite(compressed_mem, pmem + written,
-                    (unsigned int) pass_size) != (int) pass_size) {
-            fatal("Write failed on physical memory checkpoint file '%s'\n",
-                  filename);
+            const uint8_t *data = entry.kind == ChunkEntry::Raw ?
+                pmem + (first + i) * chunkSize : buffers[i].data();
+            writeAll(fd, data, entry.size, filename);
+            offset += entry.size;
         }
     }
 
-    // close the compressed stream and check that the exit status
-    // is zero
-    if (gzclose(compressed_mem))
+    header.indexOffset = offset;
+    writeAll(fd, index.data(), index.size() * sizeof(ChunkEntry), filename);
+    if (pwrite(fd, &header, sizeof(header), 0) != sizeof(header))
+        fatal("Write failed on physical memory checkpoint file '%s'\n",
+              filename);
+
+    if (close(fd))
         fatal("Close failed on physical memory checkpoint file '%s'\n",
               filename);
 
+    DPRINTF(Checkpoint, "Wrote %d of %d chunks of %s, %d bytes\n",
+            chunks - zero_chunks, chunks, filename,
+            offset + index.size() * sizeof(ChunkEntry));
 }
 
 void
@@ -398,8 +573,6 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
 void
 PhysicalMemory::unserializeStore(CheckpointIn &cp)
 {
-    const uint32_t chunk_size = 16384;
-
     unsigned int store_id;
     UNSERIALIZE_SCALAR(store_id);
 
@@ -407,11 +580,6 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     string filepath = cp.cptDir + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
     uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
@@ -426,11 +594,93 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    uint64_t chunk_size;
+    if (optParamIn(cp, "chunk_size", chunk_size, false))
+        unserializeChunkedStore(filepath, filename, pmem, range_size);
+    else
+        unserializeGzipStore(filepath, filename, pmem, range_size);
+}
+
+void
+PhysicalMemory::unserializeChunkedStore(const string &filepath,
+                                        const string &filename,
+                                        uint8_t *pmem, uint64_t range_size)
+{
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd < 0)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
+    ChunkFileHeader header;
+    if (!readAll(fd, &header, sizeof(header), 0) ||
+        memcmp(header.magic, chunkFileMagic, sizeof(header.magic)) != 0) {
+        fatal("'%s' is not a chunked physical memory checkpoint\n",
+              filename);
+    }
+    if (header.version != chunkFileVersion)
+        fatal("Unsupported version %d of physical memory checkpoint '%s'\n",
+              header.version, filename);
+    if (header.rangeSize != range_size)
+        fatal("Physical memory checkpoint '%s' has the wrong size\n",
+              filename);
+
+    const uint64_t chunk_size = header.chunkSize;
+    const uint64_t chunks = divCeil(range_size, chunk_size);
+    vector<ChunkEntry> index(chunks);
+    if (!readAll(fd, index.data(), chunks * sizeof(ChunkEntry),
+                 header.indexOffset)) {
+        fatal("Can't read the index of physical memory checkpoint '%s'\n",
+              filename);
+    }
+
+    // Each thread reads its chunks straight into the backing store,
+    // and leaves the pages of zero chunks untouched
+    atomic<bool> failed(false);
+    parallelFor(chunks, [&](uint64_t i) {
+        const ChunkEntry &entry = index[i];
+        const uint64_t start = i * chunk_size;
+        const uint64_t size = min(chunk_size, range_size - start);
+
+        if (entry.kind == ChunkEntry::Raw) {
+            if (entry.size != size ||
+                !readAll(fd, pmem + start, size, entry.offset)) {
+                failed = true;
+            }
+        } else if (entry.kind == ChunkEntry::Deflate) {
+            vector<uint8_t> compressed(entry.size);
+            uLongf inflated = size;
+            if (!readAll(fd, compressed.data(), entry.size, entry.offset) ||
+                uncompress(pmem + start, &inflated, compressed.data(),
+                           entry.size) != Z_OK ||
+                inflated != size) {
+                failed = true;
+            }
+        }
+    });
+
+    if (failed)
+        fatal("Physical memory checkpoint file '%s' is corrupt\n", filename);
+
+    close(fd);
+}
+
+void
+PhysicalMemory::unserializeGzipStore(const string &filepath,
+                                     const string &filename,
+                                     uint8_t *pmem, uint64_t range_size)
+{
+    const uint32_t chunk_size = 16384;
+
+    // Checkpoints from before the chunked format are a single gzip
+    // stream of the whole store
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
     uint64_t curr_size = 0;
     long* temp_page = new long[chunk_size];
     long* pmem_current;
     uint32_t bytes_read;
-    while (curr_size < range.size()) {
+    while (curr_size < range_size) {
         bytes_read = gzread(compressed_mem, temp_page, chunk_size);
         if (bytes_read == 0)
             break;
@@ -265,6 +265,23 @@ class PhysicalMemory : public Serializable
      */
     void unserializeStore(CheckpointIn &cp);
 
+  private:
+    /**
+     * Restore a backing store from a chunked checkpoint file,
+     * decompressing the chunks in parallel.
+     */
+    void unserializeChunkedStore(const std::string &filepath,
+                                 const std::string &filename,
+                                 uint8_t *pmem, uint64_t range_size);
+
+    /**
+     * Restore a backing store from a checkpoint file written as a
+     * single gzip stream, as checkpoints used to be.
+     */
+    void unserializeGzipStore(const std::string &filepath,
+                              const std::string &filename,
+                              uint8_t *pmem, uint64_t range_size);
+
 };
 
 #endif //__MEM_PHYSICAL_HH__
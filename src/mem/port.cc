@@ -169,6 +169,13 @@ MasterPort::sendAtomic(PacketPtr pkt)
     return _slavePort->recvAtomic(pkt);
 }
 
+Tick
+MasterPort::sendAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+{
+    assert(pkt->isRequest());
+    return _slavePort->recvAtomicBackdoor(pkt, backdoor);
+}
+
 void
 MasterPort::sendFunctional(PacketPtr pkt)
 {
@@ -206,7 +213,7 @@ MasterPort::sendRetryResp()
 void
 MasterPort::printAddr(Addr a)
 {
-    auto req = std::make_shared<Request>(
+    auto req = makeRequest(
         a, 1, 0, Request::funcMasterId);
 
     Packet pkt(req, MemCmd::PrintReq);
@@ -51,6 +51,7 @@
 #define __MEM_PORT_HH__
 
 #include "base/addr_range.hh"
+#include "mem/backdoor.hh"
 #include "mem/packet.hh"
 
 class MemObject;
@@ -201,6 +202,19 @@ class MasterPort : public BaseMasterPort
      */
     Tick sendAtomic(PacketPtr pkt);
 
+    /**
+     * Send an atomic request packet like sendAtomic, and additionally
+     * ask the slave for a backdoor covering the accessed address. The
+     * backdoor is left untouched if none of the objects along the
+     * path is able to hand one out.
+     *
+     * @param pkt Packet to send.
+     * @param backdoor Filled in with the grant, if any.
+     *
+     * @return Estimated latency of access.
+     */
+    Tick sendAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor);
+
     /**
      * Send a functional request packet, where the data is instantly
      * updated everywhere in the memory system, without affecting the
@@ -333,6 +347,14 @@ class MasterPort : public BaseMasterPort
      * interconnect component like a bus.
      */
     virtual void recvRangeChange() { }
+
+    /**
+     * Called by the slave port when backdoors overlapping the given
+     * range are no longer valid. The default implementation does
+     * nothing, masters that use backdoors, and interconnect
+     * components passing them on, must override it.
+     */
+    virtual void recvBackdoorInvalidate(const AddrRange &range) { }
 };
 
 /**
@@ -426,6 +448,15 @@ class SlavePort : public BaseSlavePort
         _masterPort->recvRangeChange();
     }
 
+    /**
+     * Called by the owner to revoke any backdoor overlapping the
+     * given range that was handed out through this port.
+     */
+    void sendBackdoorInvalidate(const AddrRange &range) const {
+        if (_masterPort)
+            _masterPort->recvBackdoorInvalidate(range);
+    }
+
     /**
      * Get a list of the non-overlapping address ranges the owner is
      * responsible for. All slave ports must override this function
@@ -454,6 +485,16 @@ class SlavePort : public BaseSlavePort
      */
     virtual Tick recvAtomic(PacketPtr pkt) = 0;
 
+    /**
+     * Receive an atomic request packet from the master port, along
+     * with a request for a backdoor. The default implementation
+     * performs a normal atomic access and grants nothing.
+     */
+    virtual Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+    {
+        return recvAtomic(pkt);
+    }
+
     /**
      * Receive a functional request packet from the master port.
      */
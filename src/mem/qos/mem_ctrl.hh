@@ -392,13 +392,12 @@ MemCtrl::escalateQueues(Queues& queues, uint64_t queue_entry_size,
                 writeQueueSizes[tgt_prio] += moved_entries;
             }
 
-            // Change QoS priority and move packet
+            // Change QoS priority and move packet. Erase element from
+            // source packet queue first, this will increment the
+            // iterator, as queues may keep bookkeeping in the packet
             pkt->qosValue(tgt_prio);
-            queues[tgt_prio].push_back(pkt);
-
-            // Erase element from source packet queue, this will
-            // increment the iterator
             it = queues[curr_prio].erase(it);
+            queues[tgt_prio].push_back(pkt);
             panic_if(packetPriorities[m_id][curr_prio] < moved_entries,
                      "QoSMemCtrl::escalate master %s negative packets "
                      "for priority %d",
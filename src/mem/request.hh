@@ -54,9 +54,12 @@
 
 #include <cassert>
 #include <climits>
+#include <memory>
+#include <utility>
 
 #include "base/flags.hh"
 #include "base/logging.hh"
+#include "base/pool_allocator.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "sim/core.hh"
@@ -84,6 +87,18 @@ class Request;
 typedef std::shared_ptr<Request> RequestPtr;
 typedef uint16_t MasterID;
 
+/**
+ * Create a request. The request and its reference count share a block
+ * from a per-thread pool rather than the heap.
+ */
+template <typename... Args>
+RequestPtr
+makeRequest(Args&&... args)
+{
+    return std::allocate_shared<Request>(PoolAllocator<Request>(),
+                                         std::forward<Args>(args)...);
+}
+
 class Request
 {
   public:
@@ -572,8 +587,8 @@ class Request
         assert(privateFlags.isSet(VALID_VADDR));
         assert(privateFlags.noneSet(VALID_PADDR));
         assert(split_addr > _vaddr && split_addr < _vaddr + _size);
-        req1 = std::make_shared<Request>(*this);
-        req2 = std::make_shared<Request>(*this);
+        req1 = makeRequest(*this);
+        req2 = makeRequest(*this);
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
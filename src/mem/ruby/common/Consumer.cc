@@ -49,7 +49,7 @@ Consumer::scheduleEventAbsolute(Tick evt_time)
     }
 
     Tick t = em->clockEdge();
-    set<Tick>::iterator bit = m_scheduled_wakeups.begin();
-    set<Tick>::iterator eit = m_scheduled_wakeups.lower_bound(t);
-    m_scheduled_wakeups.erase(bit,eit);
+    auto bit = m_scheduled_wakeups.begin();
+    auto eit = std::lower_bound(bit, m_scheduled_wakeups.end(), t);
+    m_scheduled_wakeups.erase(bit, eit);
 }
@@ -41,7 +41,8 @@ using namespace std;
 using m5::stl_helpers::operator<<;
 
 MessageBuffer::MessageBuffer(const Params *p)
-    : SimObject(p), m_stall_map_size(0),
+    : SimObject(p), m_timing_wheel(p->timing_wheel), m_wheel_size(0),
+    m_stall_map_size(0),
     m_max_size(p->buffer_size), m_time_last_time_size_checked(0),
     m_time_last_time_enqueue(0), m_time_last_time_pop(0),
     m_last_arrival_time(0), m_strict_fifo(p->ordered),
@@ -69,7 +70,7 @@ MessageBuffer::getSize(Tick curTime)
 {
     if (m_time_last_time_size_checked != curTime) {
         m_time_last_time_size_checked = curTime;
-        m_size_last_time_size_checked = m_prio_heap.size();
+        m_size_last_time_size_checked = numMessages();
     }
 
     return m_size_last_time_size_checked;
@@ -92,7 +93,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
 
     if (m_time_last_time_pop < current_time) {
         // no pops this cycle - heap size is correct
-        current_size = m_prio_heap.size();
+        current_size = numMessages();
     } else {
         if (m_time_last_time_enqueue < current_time) {
             // no enqueues this cycle - m_size_at_cycle_start is correct
@@ -110,7 +111,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
     } else {
         DPRINTF(RubyQueue, "n: %d, current_size: %d, heap size: %d, "
                 "m_max_size: %d\n",
-                n, current_size, m_prio_heap.size(), m_max_size);
+                n, current_size, numMessages(), m_max_size);
         m_not_avail_count++;
         return false;
     }
@@ -120,7 +121,7 @@ const Message*
 MessageBuffer::peek() const
 {
     DPRINTF(RubyQueue, "Peeking at head of queue.\n");
-    const Message* msg_ptr = m_prio_heap.front().get();
+    const Message* msg_ptr = frontMessage().get();
     assert(msg_ptr);
 
     DPRINTF(RubyQueue, "Message: %s\n", (*msg_ptr));
@@ -200,29 +201,75 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta)
     msg_ptr->setLastEnqueueTime(arrival_time);
     msg_ptr->setMsgCounter(m_msg_counter);
 
-    // Insert the message into the priority heap
-    m_prio_heap.push_back(message);
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
-    // Increment the number of messages statistic
-    m_buf_msgs++;
-
     DPRINTF(RubyQueue, "Enqueue arrival_time: %lld, Message: %s\n",
             arrival_time, *(message.get()));
 
+    pushMessage(std::move(message));
+    // Increment the number of messages statistic
+    m_buf_msgs++;
+
     // Schedule the wakeup
     assert(m_consumer != NULL);
     m_consumer->scheduleEventAbsolute(arrival_time);
     m_consumer->storeEventInfo(m_vnet_id);
 }
 
+void
+MessageBuffer::pushMessage(MsgPtr message)
+{
+    if (!m_timing_wheel) {
+        m_prio_heap.push_back(std::move(message));
+        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
+                  greater<MsgPtr>());
+        return;
+    }
+
+    // Find the slot from the back, where almost all messages go
+    const Tick time = message->getLastEnqueueTime();
+    auto slot = m_wheel.end();
+    while (slot != m_wheel.begin() && prev(slot)->time > time) {
+        --slot;
+    }
+    if (slot == m_wheel.begin() || prev(slot)->time != time) {
+        slot = m_wheel.emplace(slot, time);
+    } else {
+        --slot;
+    }
+
+    // Recycled messages keep their counter, so they may have to go
+    // ahead of younger messages
+    slot->msgs.insert(std::move(message));
+    m_wheel_size++;
+}
+
+MsgPtr
+MessageBuffer::popMessage()
+{
+    if (!m_timing_wheel) {
+        pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
+                 greater<MsgPtr>());
+        MsgPtr message = std::move(m_prio_heap.back());
+        m_prio_heap.pop_back();
+        return message;
+    }
+
+    WheelSlot &slot = m_wheel.front();
+    MsgPtr message = slot.msgs.pop_front();
+    if (slot.msgs.empty()) {
+        m_wheel.pop_front();
+    }
+    m_wheel_size--;
+    return message;
+}
+
 Tick
 MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
 {
     DPRINTF(RubyQueue, "Popping\n");
     assert(isReady(current_time));
 
-    // get MsgPtr of the message about to be dequeued
-    MsgPtr message = m_prio_heap.front();
+    // get the message about to be dequeued
+    const MsgPtr &message = frontMessage();
 
     // get the delay cycles
     message->updateDelayedTicks(current_time);
@@ -233,12 +280,11 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     // record previous size and time so the current buffer size isn't
     // adjusted until schd cycle
     if (m_time_last_time_pop < current_time) {
-        m_size_at_cycle_start = m_prio_heap.size();
+        m_size_at_cycle_start = numMessages();
         m_time_last_time_pop = current_time;
     }
 
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
-    m_prio_heap.pop_back();
+    popMessage();
     if (decrement_messages) {
         // If the message will be removed from the queue, decrement the
         // number of message in the queue.
@@ -269,6 +315,8 @@ void
 MessageBuffer::clear()
 {
     m_prio_heap.clear();
+    m_wheel.clear();
+    m_wheel_size = 0;
 
     m_msg_counter = 0;
     m_time_last_time_enqueue = 0;
@@ -282,32 +330,27 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
 {
     DPRINTF(RubyQueue, "Recycling.\n");
     assert(isReady(current_time));
-    MsgPtr node = m_prio_heap.front();
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
+    MsgPtr node = popMessage();
 
     Tick future_time = current_time + recycle_latency;
     node->setLastEnqueueTime(future_time);
 
-    m_prio_heap.back() = node;
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), greater<MsgPtr>());
+    pushMessage(std::move(node));
     m_consumer->scheduleEventAbsolute(future_time);
 }
 
 void
-MessageBuffer::reanalyzeList(list<MsgPtr> &lt, Tick schdTick)
+MessageBuffer::reanalyzeList(MessageList &lt, Tick schdTick)
 {
     while (!lt.empty()) {
         m_msg_counter++;
-        MsgPtr m = lt.front();
+        MsgPtr m = lt.pop_front();
         m->setLastEnqueueTime(schdTick);
         m->setMsgCounter(m_msg_counter);
 
-        m_prio_heap.push_back(m);
-        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                  greater<MsgPtr>());
+        pushMessage(std::move(m));
 
         m_consumer->scheduleEventAbsolute(schdTick);
-        lt.pop_front();
     }
 }
 
@@ -355,7 +398,7 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     DPRINTF(RubyQueue, "Stalling due to %#x\n", addr);
     assert(isReady(current_time));
     assert(getOffset(addr) == 0);
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = frontMessage();
 
     // Since the message will just be moved to stall map, indicate that the
     // buffer should not decrement the m_buf_msgs statistic
@@ -366,7 +409,7 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     // Instead the controller is responsible to call reanalyzeMessages when
     // these addresses change state.
     //
-    (m_stall_msg_map[addr]).push_back(message);
+    (m_stall_msg_map[addr]).push_back(std::move(message));
     m_stall_map_size++;
     m_stall_count++;
 }
@@ -381,14 +424,16 @@ MessageBuffer::print(ostream& out) const
 
     vector<MsgPtr> copy(m_prio_heap);
     sort_heap(copy.begin(), copy.end(), greater<MsgPtr>());
+    for (auto &slot : m_wheel)
+        slot.msgs.forEach([&copy](const MsgPtr &msg) { copy.push_back(msg); });
     ccprintf(out, "%s] %s", copy, name());
 }
 
 bool
 MessageBuffer::isReady(Tick current_time) const
 {
-    return ((m_prio_heap.size() > 0) &&
-        (m_prio_heap.front()->getLastEnqueueTime() <= current_time));
+    return ((numMessages() > 0) &&
+        (frontMessage()->getLastEnqueueTime() <= current_time));
 }
 
 void
@@ -431,13 +476,19 @@ MessageBuffer::functionalWrite(Packet *pkt)
 {
     uint32_t num_functional_writes = 0;
 
-    // Check the priority heap and write any messages that may
-    // correspond to the address in the packet.
-    for (unsigned int i = 0; i < m_prio_heap.size(); ++i) {
-        Message *msg = m_prio_heap[i].get();
+    auto write = [pkt, &num_functional_writes](const MsgPtr &msg) {
         if (msg->functionalWrite(pkt)) {
             num_functional_writes++;
         }
+    };
+
+    // Check the priority heap or the timing wheel and write any
+    // messages that may correspond to the address in the packet.
+    for (unsigned int i = 0; i < m_prio_heap.size(); ++i) {
+        write(m_prio_heap[i]);
+    }
+    for (auto &slot : m_wheel) {
+        slot.msgs.forEach(write);
     }
 
     // Check the stall queue and write any messages that may
@@ -445,15 +496,7 @@ MessageBuffer::functionalWrite(Packet *pkt)
     for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
          map_iter != m_stall_msg_map.end();
          ++map_iter) {
-
-        for (std::list<MsgPtr>::iterator it = (map_iter->second).begin();
-            it != (map_iter->second).end(); ++it) {
-
-            Message *msg = (*it).get();
-            if (msg->functionalWrite(pkt)) {
-                num_functional_writes++;
-            }
-        }
+        map_iter->second.forEach(write);
     }
 
     return num_functional_writes;
@@ -36,8 +36,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <deque>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -45,6 +47,7 @@
 #include "debug/RubyQueue.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/network/MessageList.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 #include "mem/packet.hh"
 #include "params/MessageBuffer.hh"
@@ -66,11 +69,7 @@ class MessageBuffer : public SimObject
     void
     delayHead(Tick current_time, Tick delta)
     {
-        MsgPtr m = m_prio_heap.front();
-        std::pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                      std::greater<MsgPtr>());
-        m_prio_heap.pop_back();
-        enqueue(m, current_time, delta);
+        enqueue(popMessage(), current_time, delta);
     }
 
     bool areNSlotsAvailable(unsigned int n, Tick curTime);
@@ -95,7 +94,7 @@ class MessageBuffer : public SimObject
     //! message queue.  The function assumes that the queue is nonempty.
     const Message* peek() const;
 
-    const MsgPtr &peekMsgPtr() const { return m_prio_heap.front(); }
+    const MsgPtr &peekMsgPtr() const { return frontMessage(); }
 
     void enqueue(MsgPtr message, Tick curTime, Tick delta);
 
@@ -107,7 +106,7 @@ class MessageBuffer : public SimObject
     void unregisterDequeueCallback();
 
     void recycle(Tick current_time, Tick recycle_latency);
-    bool isEmpty() const { return m_prio_heap.size() == 0; }
+    bool isEmpty() const { return numMessages() == 0; }
     bool isStallMapEmpty() { return m_stall_msg_map.size() == 0; }
     unsigned int getStallMapSize() { return m_stall_msg_map.size(); }
 
@@ -129,19 +128,64 @@ class MessageBuffer : public SimObject
     uint32_t functionalWrite(Packet *pkt);
 
   private:
-    void reanalyzeList(std::list<MsgPtr> &, Tick);
+    void reanalyzeList(MessageList &, Tick);
+
+    //! Number of messages waiting to be dequeued
+    unsigned int
+    numMessages() const
+    {
+        return m_timing_wheel ? m_wheel_size : m_prio_heap.size();
+    }
+
+    //! The message to be dequeued next
+    const MsgPtr &
+    frontMessage() const
+    {
+        return m_timing_wheel ? m_wheel.front().msgs.front() :
+            m_prio_heap.front();
+    }
+
+    //! Add a message, ordered by its last enqueue time and counter
+    void pushMessage(MsgPtr message);
+    MsgPtr popMessage();
 
   private:
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
     Consumer* m_consumer;
+
+    /**
+     * Keep the messages in a timing wheel rather than a heap. Either
+     * way they come out ordered by the time they can be dequeued and
+     * then by their message counter.
+     */
+    const bool m_timing_wheel;
+
     std::vector<MsgPtr> m_prio_heap;
 
+    //! Messages that can be dequeued at the same time
+    struct WheelSlot
+    {
+        WheelSlot(Tick t) : time(t) { }
+        Tick time;
+        MessageList msgs;
+    };
+
+    /**
+     * The timing wheel, one slot per distinct time pending messages
+     * can be dequeued at, in time order. Buffers with a fixed latency
+     * only add to the last slot or start a new one after it, and
+     * only ever have a few slots, so that the wheel doesn't need to
+     * be indexed by time.
+     */
+    std::deque<WheelSlot> m_wheel;
+    unsigned int m_wheel_size;
+
     std::function<void()> m_dequeue_callback;
 
     // use a std::map for the stalled messages as this container is
     // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    typedef std::map<Addr, MessageList> StallMsgMapType;
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
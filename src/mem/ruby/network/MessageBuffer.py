@@ -42,5 +42,9 @@ class MessageBuffer(SimObject):
                                        random delays if RubySystem \
                                        randomization flag is True)")
 
+    timing_wheel = Param.Bool(False, "Keep messages in per-arrival-time \
+                                     slots, fastest when messages arrive \
+                                     in about the order they are sent")
+
     master = MasterPort("Master port to MessageBuffer receiver")
     slave = SlavePort("Slave port from MessageBuffer sender")
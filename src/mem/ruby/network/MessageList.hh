@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_MESSAGELIST_HH__
+#define __MEM_RUBY_NETWORK_MESSAGELIST_HH__
+
+#include <cassert>
+#include <utility>
+
+#include "mem/ruby/slicc_interface/Message.hh"
+
+/**
+ * FIFO of messages linked through the messages themselves, so that
+ * queueing a message doesn't allocate. A message is in at most one
+ * list at a time.
+ */
+class MessageList
+{
+  public:
+    MessageList() : m_tail(nullptr), m_size(0) { }
+
+    MessageList(MessageList &&other)
+        : m_head(std::move(other.m_head)), m_tail(other.m_tail),
+          m_size(other.m_size)
+    {
+        other.m_tail = nullptr;
+        other.m_size = 0;
+    }
+
+    MessageList &
+    operator=(MessageList &&other)
+    {
+        clear();
+        m_head = std::move(other.m_head);
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        other.m_tail = nullptr;
+        other.m_size = 0;
+        return *this;
+    }
+
+    MessageList(const MessageList &) = delete;
+    MessageList &operator=(const MessageList &) = delete;
+
+    ~MessageList() { clear(); }
+
+    bool empty() const { return m_size == 0; }
+    unsigned size() const { return m_size; }
+
+    const MsgPtr &front() const { return m_head; }
+
+    void
+    push_back(MsgPtr msg)
+    {
+        assert(!msg->m_next);
+        Message *tail = msg.get();
+        if (m_tail)
+            m_tail->m_next = std::move(msg);
+        else
+            m_head = std::move(msg);
+        m_tail = tail;
+        m_size++;
+    }
+
+    //! Insert a message after those with a lower message counter.
+    //! Messages are normally queued in counter order, so this appends.
+    void
+    insert(MsgPtr msg)
+    {
+        if (!m_tail || m_tail->getMsgCounter() < msg->getMsgCounter()) {
+            push_back(std::move(msg));
+            return;
+        }
+
+        assert(!msg->m_next);
+        MsgPtr *link = &m_head;
+        while ((*link)->getMsgCounter() < msg->getMsgCounter())
+            link = &(*link)->m_next;
+        msg->m_next = std::move(*link);
+        *link = std::move(msg);
+        m_size++;
+    }
+
+    MsgPtr
+    pop_front()
+    {
+        assert(m_head);
+        MsgPtr msg = std::move(m_head);
+        m_head = std::move(msg->m_next);
+        if (!m_head)
+            m_tail = nullptr;
+        m_size--;
+        return msg;
+    }
+
+    void
+    clear()
+    {
+        // Unlink one at a time, releasing the head would otherwise
+        // free the list recursively.
+        while (m_head)
+            pop_front();
+    }
+
+    template <typename F>
+    void
+    forEach(F f) const
+    {
+        for (const MsgPtr *msg = &m_head; *msg; msg = &(*msg)->m_next)
+            f(*msg);
+    }
+
+  private:
+    MsgPtr m_head;
+    Message *m_tail;
+    unsigned m_size;
+};
+
+#endif // __MEM_RUBY_NETWORK_MESSAGELIST_HH__
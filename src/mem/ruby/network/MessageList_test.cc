@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "mem/ruby/network/MessageList.hh"
+
+namespace {
+
+class TestMessage : public Message
+{
+  public:
+    TestMessage(Tick time, uint64_t counter)
+        : Message(time)
+    {
+        setMsgCounter(counter);
+    }
+
+    MsgPtr clone() const override { return nullptr; }
+    void print(std::ostream &out) const override { }
+    bool functionalRead(Packet *pkt) override { return false; }
+    bool functionalWrite(Packet *pkt) override { return false; }
+};
+
+MsgPtr
+makeMsg(Tick time, uint64_t counter)
+{
+    return std::make_shared<TestMessage>(time, counter);
+}
+
+std::vector<uint64_t>
+drain(MessageList &list)
+{
+    std::vector<uint64_t> counters;
+    while (!list.empty())
+        counters.push_back(list.pop_front()->getMsgCounter());
+    return counters;
+}
+
+} // anonymous namespace
+
+TEST(MessageListTest, KeepsPushOrder)
+{
+    MessageList list;
+    for (uint64_t i = 0; i < 8; i++)
+        list.push_back(makeMsg(0, i));
+    EXPECT_EQ(8, list.size());
+
+    std::vector<uint64_t> expected = {0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(expected, drain(list));
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(MessageListTest, MoveLeavesSourceEmpty)
+{
+    MessageList list;
+    list.push_back(makeMsg(0, 1));
+    list.push_back(makeMsg(0, 2));
+
+    MessageList moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(2, moved.size());
+
+    // The moved from list has to be usable again
+    list.push_back(makeMsg(0, 3));
+    moved = std::move(list);
+    EXPECT_TRUE(list.empty());
+    std::vector<uint64_t> expected = {3};
+    EXPECT_EQ(expected, drain(moved));
+}
+
+TEST(MessageListTest, ReusesPoppedMessages)
+{
+    MessageList a, b;
+    a.push_back(makeMsg(0, 1));
+    a.push_back(makeMsg(0, 2));
+
+    // Recycling moves a message from one list to the back of another
+    b.push_back(a.pop_front());
+    b.push_back(a.pop_front());
+    a.push_back(b.pop_front());
+    EXPECT_EQ(1, a.size());
+    EXPECT_EQ(1, b.size());
+    EXPECT_EQ(1, a.front()->getMsgCounter());
+    EXPECT_EQ(2, b.front()->getMsgCounter());
+}
+
+// A timing wheel slot holds messages that can be dequeued at the same
+// time. Messages enqueued out of counter order (randomized delays,
+// recycling, reanalyzed stalls) are inserted, and have to come out in
+// the order the priority heap of MessageBuffer gives them.
+TEST(MessageListTest, InsertMatchesHeapOrder)
+{
+    std::mt19937 rng(1);
+    for (int trial = 0; trial < 200; trial++) {
+        MessageList list;
+        std::vector<MsgPtr> heap;
+        const unsigned num = 1 + rng() % 32;
+        for (unsigned i = 0; i < num; i++) {
+            // Mostly increasing counters, with some late arrivals
+            uint64_t counter = (rng() % 4) ? 1000 + trial * 64 + i
+                                           : rng() % 2000;
+            MsgPtr msg = makeMsg(5, counter);
+            heap.push_back(msg);
+            std::push_heap(heap.begin(), heap.end(), std::greater<MsgPtr>());
+            list.insert(makeMsg(5, counter));
+        }
+
+        ASSERT_EQ(heap.size(), list.size());
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<MsgPtr>());
+            ASSERT_EQ(heap.back()->getMsgCounter(),
+                      list.pop_front()->getMsgCounter()) << "trial " << trial;
+            heap.pop_back();
+        }
+        EXPECT_TRUE(list.empty());
+    }
+}
+
+TEST(MessageListTest, ClearsLongLists)
+{
+    // Releasing the messages one at a time must not recurse
+    MessageList list;
+    for (uint64_t i = 0; i < 1000000; i++)
+        list.push_back(makeMsg(0, i));
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.front());
+}
@@ -40,9 +40,12 @@
 
 #include "mem/ruby/network/Network.hh"
 
+#include <algorithm>
+
 #include "base/logging.hh"
 #include "mem/ruby/common/MachineID.hh"
 #include "mem/ruby/network/BasicLink.hh"
+#include "mem/ruby/network/BasicRouter.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
 uint32_t Network::m_virtual_networks;
@@ -64,6 +67,15 @@ Network::Network(const Params *p)
     m_topology_ptr = new Topology(p->routers.size(), p->ext_links,
                                   p->int_links);
 
+    m_event_queues.push_back(eventQueue());
+    for (auto router : p->routers) {
+        EventQueue *eq = router->eventQueue();
+        if (std::find(m_event_queues.begin(), m_event_queues.end(),
+                      eq) == m_event_queues.end()) {
+            m_event_queues.push_back(eq);
+        }
+    }
+
     // Allocate to and from queues
     // Queues that are getting messages from protocol
     m_toNetQueues.resize(m_nodes);
@@ -149,7 +149,11 @@ class Network : public ClockedObject
     std::vector<std::vector<MessageBuffer*> > m_fromNetQueues;
     std::vector<bool> m_ordered;
 
+    //! Event queues of the network and its routers, its own first
+    std::vector<EventQueue *> m_event_queues;
+
   private:
+
     //! Callback class used for collating statistics from all the
     //! controller of this type.
     class StatsCallback : public Callback
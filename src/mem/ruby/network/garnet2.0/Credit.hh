@@ -37,6 +37,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "base/pool_allocator.hh"
 #include "base/types.hh"
 #include "mem/ruby/network/garnet2.0/CommonTypes.hh"
 #include "mem/ruby/network/garnet2.0/flit.hh"
@@ -51,6 +52,24 @@ class Credit : public flit
     Credit() {};
     Credit(int vc, bool is_free_signal, Cycles curTime);
 
+    // Credits are allocated from a per-thread pool
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(Credit))
+            return ::operator new(size);
+        return BlockPool<sizeof(Credit)>::allocate();
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size != sizeof(Credit))
+            ::operator delete(p);
+        else
+            BlockPool<sizeof(Credit)>::release(p);
+    }
+
     bool is_free_signal() { return m_is_free_signal; }
 
   private:
@@ -54,7 +54,10 @@ class CrossbarSwitch : public Consumer
     void print(std::ostream& out) const {};
 
     inline void update_sw_winner(int inport, flit *t_flit)
-    { m_switch_buffer[inport]->insert(t_flit); }
+    {
+        m_switch_buffer[inport]->insert(t_flit);
+        m_num_flits++;
+    }
 
     inline double get_crossbar_activity() { return m_crossbar_activity; }
 
@@ -64,6 +67,7 @@ class CrossbarSwitch : public Consumer
   private:
     int m_num_vcs;
     int m_num_inports;
+    int m_num_flits; // flits waiting in all switch buffers
     double m_crossbar_activity;
     Router *m_router;
     std::vector<flitBuffer *> m_switch_buffer;
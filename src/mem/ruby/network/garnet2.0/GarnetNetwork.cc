@@ -444,16 +444,28 @@ GarnetNetwork::functionalWrite(Packet *pkt)
 {
     uint32_t num_functional_writes = 0;
 
-    for (unsigned int i = 0; i < m_routers.size(); i++) {
-        num_functional_writes += m_routers[i]->functionalWrite(pkt);
-    }
+    // When the routers are split over several event queues, visit
+    // the network one queue at a time, with that queue's thread kept
+    // out by its lock. Flits only move between queues at quantum
+    // barriers, which can't be reached while the caller is busy, so
+    // each flit is seen once.
+    for (auto eq : m_event_queues) {
+        EventQueue::ScopedMigration migrate(eq, inParallelMode);
+
+        for (unsigned int i = 0; i < m_routers.size(); i++) {
+            if (m_routers[i]->eventQueue() == eq)
+                num_functional_writes += m_routers[i]->functionalWrite(pkt);
+        }
 
-    for (unsigned int i = 0; i < m_nis.size(); ++i) {
-        num_functional_writes += m_nis[i]->functionalWrite(pkt);
-    }
+        for (unsigned int i = 0; i < m_nis.size(); ++i) {
+            if (m_nis[i]->eventQueue() == eq)
+                num_functional_writes += m_nis[i]->functionalWrite(pkt);
+        }
 
-    for (unsigned int i = 0; i < m_networklinks.size(); ++i) {
-        num_functional_writes += m_networklinks[i]->functionalWrite(pkt);
+        for (unsigned int i = 0; i < m_networklinks.size(); ++i) {
+            num_functional_writes +=
+                m_networklinks[i]->functionalWrite(pkt, eq);
+        }
     }
 
     return num_functional_writes;
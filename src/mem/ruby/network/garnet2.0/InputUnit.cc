@@ -49,6 +49,8 @@ InputUnit::InputUnit(int id, PortDirection direction, Router *router)
     m_router = router;
     m_num_vcs = m_router->get_num_vcs();
     m_vc_per_vnet = m_router->get_vc_per_vnet();
+    m_pending_flits = 0;
+    m_buffered_flits = 0;
 
     m_num_buffer_reads.resize(m_num_vcs/m_vc_per_vnet);
     m_num_buffer_writes.resize(m_num_vcs/m_vc_per_vnet);
@@ -88,6 +90,8 @@ InputUnit::wakeup()
     if (m_in_link->isReady(m_router->curCycle())) {
 
         t_flit = m_in_link->consumeLink();
+        assert(m_pending_flits > 0);
+        m_pending_flits--;
         int vc = t_flit->get_vc();
         t_flit->increment_hops(); // for stats
 
@@ -113,6 +117,7 @@ InputUnit::wakeup()
 
         // Buffer the flit
         m_vcs[vc]->insertFlit(t_flit);
+        m_buffered_flits++;
 
         int vnet = vc/m_vc_per_vnet;
         // number of writes same as reads
@@ -109,9 +109,20 @@ class InputUnit : public Consumer
     inline flit*
     getTopFlit(int vc)
     {
+        assert(m_buffered_flits > 0);
+        m_buffered_flits--;
         return m_vcs[vc]->getTopFlit();
     }
 
+    // A flit has been put on the input link
+    inline void notify_flit() { m_pending_flits++; }
+
+    // Flits on the input link that have not been buffered yet
+    inline bool has_pending_flits() const { return m_pending_flits > 0; }
+
+    // Flits buffered in any of the input VCs
+    inline bool has_buffered_flits() const { return m_buffered_flits > 0; }
+
     inline bool
     need_stage(int vc, flit_stage stage, Cycles time)
     {
@@ -153,6 +164,8 @@ class InputUnit : public Consumer
     PortDirection m_direction;
     int m_num_vcs;
     int m_vc_per_vnet;
+    int m_pending_flits;
+    int m_buffered_flits;
 
     Router *m_router;
     NetworkLink *m_in_link;
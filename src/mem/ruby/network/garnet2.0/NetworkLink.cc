@@ -33,6 +33,8 @@
 
 #include "mem/ruby/network/garnet2.0/NetworkLink.hh"
 
+#include <algorithm>
+
 #include "mem/ruby/network/garnet2.0/CreditLink.hh"
 
 NetworkLink::NetworkLink(const Params *p)
@@ -40,20 +42,35 @@ NetworkLink::NetworkLink(const Params *p)
       m_type(NUM_LINK_TYPES_),
       m_latency(p->link_latency),
       linkBuffer(new flitBuffer()), link_consumer(nullptr),
-      link_srcQueue(nullptr), m_link_utilized(0),
+      link_consumer_info(0), link_srcQueue(nullptr), remoteQueue(nullptr),
+      remoteCount(0), remoteCallback(this), m_link_utilized(0),
       m_vc_load(p->vcs_per_vnet * p->virt_nets)
 {
 }
 
+void
+NetworkLink::startup()
+{
+    EventQueue *consumer_queue = link_consumer->consumerEventQueue();
+    if (consumer_queue == eventQueue())
+        return;
+
+    // Flits are handed over at quantum barriers. On a link shorter
+    // than the quantum they arrive at the barrier instead of on time.
+    remoteQueue = consumer_queue;
+    remoteQueue->addQuantumCallback(&remoteCallback);
+}
+
 NetworkLink::~NetworkLink()
 {
     delete linkBuffer;
 }
 
 void
-NetworkLink::setLinkConsumer(Consumer *consumer)
+NetworkLink::setLinkConsumer(Consumer *consumer, int consumer_info)
 {
     link_consumer = consumer;
+    link_consumer_info = consumer_info;
 }
 
 void
@@ -68,13 +85,40 @@ NetworkLink::wakeup()
     if (link_srcQueue->isReady(curCycle())) {
         flit *t_flit = link_srcQueue->getTopFlit();
         t_flit->set_time(curCycle() + m_latency);
-        linkBuffer->insert(t_flit);
-        link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
+        if (remoteQueue) {
+            std::lock_guard<std::mutex> lock(remoteMutex);
+            remoteFlits.push_back({t_flit, curTick(), clockEdge(m_latency)});
+            remoteCount.fetch_add(1, std::memory_order_release);
+        } else {
+            linkBuffer->insert(t_flit);
+            link_consumer->storeEventInfo(link_consumer_info);
+            link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
+        }
         m_link_utilized++;
         m_vc_load[t_flit->get_vc()]++;
     }
 }
 
+void
+NetworkLink::receiveRemote()
+{
+    if (remoteCount.load(std::memory_order_acquire) == 0)
+        return;
+
+    // As with MessageBuffer, flits sent at the barrier tick wait for
+    // the next quantum so the result does not depend on thread timing.
+    std::lock_guard<std::mutex> lock(remoteMutex);
+    const Tick now = curTick();
+    while (!remoteFlits.empty() && remoteFlits.front().sendTick < now) {
+        RemoteFlit &rf = remoteFlits.front();
+        linkBuffer->insert(rf.t_flit);
+        link_consumer->storeEventInfo(link_consumer_info);
+        link_consumer->scheduleEventAbsolute(std::max(rf.arrival, now));
+        remoteFlits.pop_front();
+        remoteCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
 void
 NetworkLink::resetStats()
 {
@@ -98,7 +142,20 @@ CreditLinkParams::create()
 }
 
 uint32_t
-NetworkLink::functionalWrite(Packet *pkt)
+NetworkLink::functionalWrite(Packet *pkt, EventQueue *eq)
 {
-    return linkBuffer->functionalWrite(pkt);
+    uint32_t num_functional_writes = 0;
+
+    // The link buffer belongs to the consumer's event queue
+    if (eq == (remoteQueue ? remoteQueue : eventQueue()))
+        num_functional_writes += linkBuffer->functionalWrite(pkt);
+
+    if (eq == eventQueue()) {
+        std::lock_guard<std::mutex> lock(remoteMutex);
+        for (auto &rf : remoteFlits) {
+            if (rf.t_flit->functionalWrite(pkt))
+                num_functional_writes++;
+        }
+    }
+    return num_functional_writes;
 }
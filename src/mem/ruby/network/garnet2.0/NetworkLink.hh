@@ -34,9 +34,13 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET2_0_NETWORKLINK_HH__
 #define __MEM_RUBY_NETWORK_GARNET2_0_NETWORKLINK_HH__
 
+#include <atomic>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <vector>
 
+#include "base/callback.hh"
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/network/garnet2.0/CommonTypes.hh"
 #include "mem/ruby/network/garnet2.0/flitBuffer.hh"
@@ -52,7 +56,9 @@ class NetworkLink : public ClockedObject, public Consumer
     NetworkLink(const Params *p);
     ~NetworkLink();
 
-    void setLinkConsumer(Consumer *consumer);
+    void startup() override;
+
+    void setLinkConsumer(Consumer *consumer, int consumer_info = 0);
     void setSourceQueue(flitBuffer *srcQueue);
     void setType(link_type type) { m_type = type; }
     link_type getType() { return m_type; }
@@ -69,18 +75,42 @@ class NetworkLink : public ClockedObject, public Consumer
     inline flit* peekLink()       { return linkBuffer->peekTopFlit(); }
     inline flit* consumeLink()    { return linkBuffer->getTopFlit(); }
 
-    uint32_t functionalWrite(Packet *);
+    //! Write the flits that belong to event queue eq, the link
+    //! buffer to the consumer's and the flits in flight to the link's
+    uint32_t functionalWrite(Packet *, EventQueue *eq);
     void resetStats();
 
   private:
+    //! Move the flits sent before the current quantum barrier to the
+    //! link buffer of a consumer on another event queue.
+    void receiveRemote();
+
     const int m_id;
     link_type m_type;
     const Cycles m_latency;
 
     flitBuffer *linkBuffer;
     Consumer *link_consumer;
+    // Passed to the consumer with every flit so that it can tell
+    // which of its ports has work
+    int link_consumer_info;
     flitBuffer *link_srcQueue;
 
+    //! A flit on its way to a consumer on another event queue
+    struct RemoteFlit
+    {
+        flit *t_flit;
+        Tick sendTick;
+        Tick arrival;
+    };
+
+    //! Event queue of the consumer when it differs from the link's
+    EventQueue *remoteQueue;
+    std::mutex remoteMutex;
+    std::deque<RemoteFlit> remoteFlits;
+    std::atomic<unsigned> remoteCount;
+    MakeCallback<NetworkLink, &NetworkLink::receiveRemote> remoteCallback;
+
     // Statistical variables
     unsigned int m_link_utilized;
     std::vector<unsigned int> m_vc_load;
@@ -49,6 +49,7 @@ OutputUnit::OutputUnit(int id, PortDirection direction, Router *router)
     m_router = router;
     m_num_vcs = m_router->get_num_vcs();
     m_vc_per_vnet = m_router->get_vc_per_vnet();
+    m_pending_credits = 0;
     m_out_buffer = new flitBuffer();
 
     for (int i = 0; i < m_num_vcs; i++) {
@@ -134,6 +135,8 @@ OutputUnit::wakeup()
 {
     if (m_credit_link->isReady(m_router->curCycle())) {
         Credit *t_credit = (Credit*) m_credit_link->consumeLink();
+        assert(m_pending_credits > 0);
+        m_pending_credits--;
         increment_credit(t_credit->get_vc());
 
         if (t_credit->is_free_signal())
@@ -63,6 +63,12 @@ class OutputUnit : public Consumer
 
     inline PortDirection get_direction() { return m_direction; }
 
+    // A credit has been put on the credit link
+    inline void notify_credit() { m_pending_credits++; }
+
+    // Credits on the credit link that have not been processed yet
+    inline bool has_pending_credits() const { return m_pending_credits > 0; }
+
     int
     get_credit_count(int vc)
     {
@@ -101,6 +107,7 @@ class OutputUnit : public Consumer
     PortDirection m_direction;
     int m_num_vcs;
     int m_vc_per_vnet;
+    int m_pending_credits;
     Router *m_router;
     NetworkLink *m_out_link;
     CreditLink *m_credit_link;
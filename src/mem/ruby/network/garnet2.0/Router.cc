@@ -86,9 +86,11 @@ Router::wakeup()
 {
     DPRINTF(RubyNetwork, "Router %d woke up\n", m_id);
 
-    // check for incoming flits
+    // check for incoming flits, only the ports whose links carry
+    // flits need to look at them
     for (int inport = 0; inport < m_input_unit.size(); inport++) {
-        m_input_unit[inport]->wakeup();
+        if (m_input_unit[inport]->has_pending_flits())
+            m_input_unit[inport]->wakeup();
     }
 
     // check for incoming credits
@@ -98,7 +100,8 @@ Router::wakeup()
     // if we want the credit update to take place after SA, this loop should
     // be moved after the SA request
     for (int outport = 0; outport < m_output_unit.size(); outport++) {
-        m_output_unit[outport]->wakeup();
+        if (m_output_unit[outport]->has_pending_credits())
+            m_output_unit[outport]->wakeup();
     }
 
     // Switch Allocation
@@ -108,6 +111,23 @@ Router::wakeup()
     m_switch->wakeup();
 }
 
+/*
+ * The links feeding the router pass the port they belong to whenever
+ * they carry a flit or credit towards it: even values for the flit
+ * link of an input port, odd ones for the credit link of an output
+ * port.
+ */
+
+void
+Router::storeEventInfo(int info)
+{
+    int port = info >> 1;
+    if (info & 1)
+        m_output_unit[port]->notify_credit();
+    else
+        m_input_unit[port]->notify_flit();
+}
+
 void
 Router::addInPort(PortDirection inport_dirn,
                   NetworkLink *in_link, CreditLink *credit_link)
@@ -117,7 +137,7 @@ Router::addInPort(PortDirection inport_dirn,
 
     input_unit->set_in_link(in_link);
     input_unit->set_credit_link(credit_link);
-    in_link->setLinkConsumer(this);
+    in_link->setLinkConsumer(this, port_num << 1);
     credit_link->setSourceQueue(input_unit->getCreditQueue());
 
     m_input_unit.push_back(input_unit);
@@ -136,7 +156,7 @@ Router::addOutPort(PortDirection outport_dirn,
 
     output_unit->set_out_link(out_link);
     output_unit->set_credit_link(credit_link);
-    credit_link->setLinkConsumer(this);
+    credit_link->setLinkConsumer(this, (port_num << 1) | 1);
     out_link->setSourceQueue(output_unit->getOutQueue());
 
     m_output_unit.push_back(output_unit);
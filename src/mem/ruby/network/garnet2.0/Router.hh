@@ -64,6 +64,7 @@ class Router : public BasicRouter, public Consumer
 
     void wakeup();
     void print(std::ostream& out) const {};
+    void storeEventInfo(int info);
 
     void init();
     void addInPort(PortDirection inport_dirn, NetworkLink *link,
@@ -39,6 +39,7 @@
 #include "mem/ruby/slicc_interface/Message.hh"
 
 RoutingUnit::RoutingUnit(Router *router)
+    : m_rng(router->get_id())
 {
     m_router = router;
     m_routing_table.clear();
@@ -108,7 +109,7 @@ RoutingUnit::lookupRoutingTable(int vnet, NetDest msg_destination)
     // Randomly select any candidate output link
     int candidate = 0;
     if (!(m_router->get_net_ptr())->isVNetOrdered(vnet))
-        candidate = rand() % num_candidates;
+        candidate = m_rng.random<int>(0, num_candidates - 1);
 
     output_link = output_link_candidates.at(candidate);
     return output_link;
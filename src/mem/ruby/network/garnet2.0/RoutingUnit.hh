@@ -34,6 +34,7 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET2_0_ROUTINGUNIT_HH__
 #define __MEM_RUBY_NETWORK_GARNET2_0_ROUTINGUNIT_HH__
 
+#include "base/random.hh"
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/garnet2.0/CommonTypes.hh"
@@ -75,6 +76,10 @@ class RoutingUnit
   private:
     Router *m_router;
 
+    //! Picks among equal routes. Seeded by the router id so that the
+    //! choice doesn't depend on which thread simulates the router.
+    Random m_rng;
+
     // Routing Table
     std::vector<NetDest> m_routing_table;
     std::vector<int> m_weight_table;
@@ -61,6 +61,7 @@ SwitchAllocator::init()
     m_round_robin_inport.resize(m_num_outports);
     m_round_robin_invc.resize(m_num_inports);
     m_port_requests.resize(m_num_outports);
+    m_outport_requested.resize(m_num_outports, false);
     m_vc_winners.resize(m_num_outports);
 
     for (int i = 0; i < m_num_inports; i++) {
@@ -114,6 +115,10 @@ SwitchAllocator::arbitrate_inports()
     // Select a VC from each input in a round robin manner
     // Independent arbiter at each input port
     for (int inport = 0; inport < m_num_inports; inport++) {
+        // nothing to arbitrate for at empty input ports
+        if (!m_input_unit[inport]->has_buffered_flits())
+            continue;
+
         int invc = m_round_robin_invc[inport];
 
         for (int invc_iter = 0; invc_iter < m_num_vcs; invc_iter++) {
@@ -134,6 +139,7 @@ SwitchAllocator::arbitrate_inports()
                 if (make_request) {
                     m_input_arbiter_activity++;
                     m_port_requests[outport][inport] = true;
+                    m_outport_requested[outport] = true;
                     m_vc_winners[outport][inport]= invc;
 
                     // Update Round Robin pointer
@@ -173,6 +179,9 @@ SwitchAllocator::arbitrate_outports()
     // Again do round robin arbitration on these requests
     // Independent arbiter at each output port
     for (int outport = 0; outport < m_num_outports; outport++) {
+        if (!m_outport_requested[outport])
+            continue;
+
         int inport = m_round_robin_inport[outport];
 
         for (int inport_iter = 0; inport_iter < m_num_inports;
@@ -358,6 +367,9 @@ SwitchAllocator::check_for_wakeup()
     Cycles nextCycle = m_router->curCycle() + Cycles(1);
 
     for (int i = 0; i < m_num_inports; i++) {
+        if (!m_input_unit[i]->has_buffered_flits())
+            continue;
+
         for (int j = 0; j < m_num_vcs; j++) {
             if (m_input_unit[i]->need_stage(j, SA_, nextCycle)) {
                 m_router->schedule_wakeup(Cycles(1));
@@ -382,9 +394,13 @@ void
 SwitchAllocator::clear_request_vector()
 {
     for (int i = 0; i < m_num_outports; i++) {
+        if (!m_outport_requested[i])
+            continue;
+
         for (int j = 0; j < m_num_inports; j++) {
             m_port_requests[i][j] = false;
         }
+        m_outport_requested[i] = false;
     }
 }
 
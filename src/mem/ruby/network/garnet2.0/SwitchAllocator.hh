@@ -82,6 +82,7 @@ class SwitchAllocator : public Consumer
     std::vector<int> m_round_robin_invc;
     std::vector<int> m_round_robin_inport;
     std::vector<std::vector<bool>> m_port_requests;
+    std::vector<bool> m_outport_requested; // any request in m_port_requests
     std::vector<std::vector<int>> m_vc_winners; // a list for each outport
     std::vector<InputUnit *> m_input_unit;
     std::vector<OutputUnit *> m_output_unit;
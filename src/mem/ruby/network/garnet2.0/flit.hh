@@ -37,6 +37,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "base/pool_allocator.hh"
 #include "base/types.hh"
 #include "mem/ruby/network/garnet2.0/CommonTypes.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
@@ -48,6 +49,24 @@ class flit
     flit(int id, int vc, int vnet, RouteInfo route, int size,
          MsgPtr msg_ptr, Cycles curTime);
 
+    // Flits are allocated from a per-thread pool
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(flit))
+            return ::operator new(size);
+        return BlockPool<sizeof(flit)>::allocate();
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size != sizeof(flit))
+            ::operator delete(p);
+        else
+            BlockPool<sizeof(flit)>::release(p);
+    }
+
     int get_outport() {return m_outport; }
     int get_size() { return m_size; }
     Cycles get_enqueue_time() { return m_enqueue_time; }
@@ -50,7 +50,7 @@ operator<(const LinkOrder& l1, const LinkOrder& l2)
 }
 
 PerfectSwitch::PerfectSwitch(SwitchID sid, Switch *sw, uint32_t virt_nets)
-    : Consumer(sw), m_switch_id(sid), m_switch(sw)
+    : Consumer(sw), m_switch_id(sid), m_switch(sw), m_rng(sid)
 {
     m_round_robin_start = 0;
     m_wakeups_wo_switch = 0;
@@ -182,7 +182,7 @@ PerfectSwitch::operateMessageBuffer(MessageBuffer *buffer, int incoming,
                     }
                     int value =
                         (out_queue_length << 8) |
-                        random_mt.random(0, 0xff);
+                        m_rng.random(0, 0xff);
                     m_link_order[out].m_link = out;
                     m_link_order[out].m_value = value;
                 }
@@ -40,6 +40,7 @@
 #include <string>
 #include <vector>
 
+#include "base/random.hh"
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/common/TypeDefines.hh"
 
@@ -91,6 +92,10 @@ class PerfectSwitch : public Consumer
     const SwitchID m_switch_id;
     Switch * const m_switch;
 
+    //! Breaks ties between equally loaded links, seeded by the switch
+    //! id so that the result doesn't depend on the simulating thread
+    Random m_rng;
+
     // vector of queues from the components
     std::vector<std::vector<MessageBuffer*> > m_in;
     std::vector<std::vector<MessageBuffer*> > m_out;
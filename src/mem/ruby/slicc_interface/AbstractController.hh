@@ -43,6 +43,7 @@
 
 #include <exception>
 #include <iostream>
+#include <set>
 #include <string>
 
 #include "base/addr_range.hh"
@@ -104,6 +104,8 @@ class Message
     void setVnet(int net) { vnet = net; }
 
   private:
+    friend class MessageList;
+
     const Tick m_time;
     Tick m_LastEnqueueTime; // my last enqueue time
     Tick m_DelayedTicks; // my delayed cycles
@@ -112,6 +114,9 @@ class Message
     // Variables for required network traversal
     int incoming_link;
     int vnet;
+
+    //! Next message in the MessageList holding this one, not copied
+    MsgPtr m_next;
 };
 
 inline bool
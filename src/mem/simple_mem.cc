@@ -80,6 +80,26 @@ SimpleMemory::recvAtomic(PacketPtr pkt)
     return getLatency();
 }
 
+Tick
+SimpleMemory::recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor)
+{
+    Tick latency = recvAtomic(pkt);
+
+    // a random latency component cannot be expressed in a grant, so
+    // only memories with a fixed latency hand out backdoors
+    if (latency_var == 0)
+        getBackdoor(backdoor, latency);
+
+    return latency;
+}
+
+void
+SimpleMemory::sendBackdoorInvalidate(const AddrRange &r)
+{
+    if (port.isConnected())
+        port.sendBackdoorInvalidate(r);
+}
+
 void
 SimpleMemory::recvFunctional(PacketPtr pkt)
 {
@@ -271,6 +291,13 @@ SimpleMemory::MemoryPort::recvAtomic(PacketPtr pkt)
     return memory.recvAtomic(pkt);
 }
 
+Tick
+SimpleMemory::MemoryPort::recvAtomicBackdoor(PacketPtr pkt,
+                                             MemBackdoor &backdoor)
+{
+    return memory.recvAtomicBackdoor(pkt, backdoor);
+}
+
 void
 SimpleMemory::MemoryPort::recvFunctional(PacketPtr pkt)
 {
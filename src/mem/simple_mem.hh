@@ -97,6 +97,8 @@ class SimpleMemory : public AbstractMemory
 
         Tick recvAtomic(PacketPtr pkt);
 
+        Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor);
+
         void recvFunctional(PacketPtr pkt);
 
         bool recvTimingReq(PacketPtr pkt);
@@ -195,12 +197,16 @@ class SimpleMemory : public AbstractMemory
 
     Tick recvAtomic(PacketPtr pkt);
 
+    Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoor &backdoor);
+
     void recvFunctional(PacketPtr pkt);
 
     bool recvTimingReq(PacketPtr pkt);
 
     void recvRespRetry();
 
+    void sendBackdoorInvalidate(const AddrRange &r) override;
+
 };
 
 #endif //__MEM_SIMPLE_MEMORY_HH__
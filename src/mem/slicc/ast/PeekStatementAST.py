@@ -58,11 +58,26 @@ class PeekStatementAST(StatementAST):
         # Declare the new "in_msg_ptr" variable
         mtid = msg_type.c_ident
         qcode = self.queue_name.var.code
+        port = self.queue_name.var.ident
         code('''
 {
     // Declare message
     const $mtid* in_msg_ptr M5_VAR_USED;
-    in_msg_ptr = dynamic_cast<const $mtid *>(($qcode).${{self.method}}());
+    const Message *msg_ptr = ($qcode).${{self.method}}();
+    if (s_${port}_exclusive) {
+        // No other in port reads this buffer, so the message has to
+        // have this port's type.
+        panic_if(typeid(*msg_ptr) != typeid($mtid),
+                 "%s: %s message on in port ${port}\\n", name(),
+                 typeid(*msg_ptr).name());
+        in_msg_ptr = static_cast<const $mtid *>(msg_ptr);
+    } else if (typeid(*msg_ptr) == typeid($mtid)) {
+        // Shared buffers mostly carry one message type, check for it
+        // before falling back to a full dynamic cast.
+        in_msg_ptr = static_cast<const $mtid *>(msg_ptr);
+    } else {
+        in_msg_ptr = dynamic_cast<const $mtid *>(msg_ptr);
+    }
     if (in_msg_ptr == NULL) {
         // If the cast fails, this is the wrong inport (wrong message type).
         // Throw an exception, and the caller will decide to either try a
@@ -32,6 +32,7 @@ from slicc.symbols.Symbol import Symbol
 from slicc.symbols.Var import Var
 import slicc.generate.html as html
 import re
+import textwrap
 
 python_class_map = {
                     "int": "Int",
@@ -194,6 +195,23 @@ class StateMachine(Symbol):
                 action.warning(error_msg)
         self.table = table
 
+    def printStateEventTable(self, code, decl, entry):
+        """Print a constant array indexed by state and event that is
+        initialized with entry(trans), trans being None for pairs
+        without a transition."""
+        code('$decl[${{self.ident}}_State_NUM][${{self.ident}}_Event_NUM] = {')
+        code.indent()
+        for state in self.states.itervalues():
+            values = [ entry(self.table.get((state, event), None))
+                       for event in self.events.itervalues() ]
+            code('// ${{state.ident}}')
+            code('{')
+            for line in textwrap.wrap(", ".join(values), 72):
+                code('    $line')
+            code('},')
+        code.dedent()
+        code('};')
+
     # determine the port->msg buffer mappings
     def getBufferMaps(self, ident):
         msg_bufs = []
@@ -272,6 +290,7 @@ class $py_ident(RubyController):
 #include <sstream>
 #include <string>
 
+#include "base/cast.hh"
 #include "mem/protocol/TransitionResult.hh"
 #include "mem/protocol/Types.hh"
 #include "mem/ruby/common/Consumer.hh"
@@ -315,7 +334,6 @@ class $c_ident : public AbstractController
     int functionalWriteBuffers(PacketPtr&);
 
     void countTransition(${ident}_State state, ${ident}_Event event);
-    void possibleTransition(${ident}_State state, ${ident}_Event event);
     uint64_t getEventCount(${ident}_Event event);
     bool isPossible(${ident}_State state, ${ident}_Event event);
     uint64_t getTransitionCount(${ident}_State state, ${ident}_Event event);
@@ -366,7 +384,21 @@ TransitionResult doTransitionWorker(${ident}_Event event,
 
 int m_counters[${ident}_State_NUM][${ident}_Event_NUM];
 int m_event_counters[${ident}_Event_NUM];
-bool m_possible[${ident}_State_NUM][${ident}_Event_NUM];
+static const bool s_possible[${ident}_State_NUM][${ident}_Event_NUM];
+''')
+
+        # An in port that is the only reader of its buffer only ever
+        # sees messages of its own type, so its peeks skip the run-time
+        # type check.
+        port_to_buf_map, in_msg_bufs, msg_bufs = self.getBufferMaps(ident)
+        for port in self.in_ports:
+            buf_name = msg_bufs[port_to_buf_map[port]]
+            exclusive = "true" if len(in_msg_bufs[buf_name]) == 1 \
+                        else "false"
+            code('static constexpr bool s_${{port.ident}}_exclusive = '
+                 '$exclusive;')
+
+        code('''
 
 static std::vector<Stats::Vector *> eventVec;
 static std::vector<std::vector<Stats::Vector *> > transVec;
@@ -461,6 +493,9 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
 #include "base/compiler.hh"
 #include "mem/ruby/common/BoolVec.hh"
 #include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/ProtocolTrace.hh"
 
 ''')
         for f in self.debug_flags:
@@ -501,12 +536,21 @@ ${c_ident}Params::create()
 int $c_ident::m_num_controllers = 0;
 std::vector<Stats::Vector *>  $c_ident::eventVec;
 std::vector<std::vector<Stats::Vector *> >  $c_ident::transVec;
+''')
 
+        # Transitions that are counted, i.e. those that don't stall
+        self.printStateEventTable(code, "const bool %s::s_possible" % c_ident,
+            lambda trans: "true" if trans and not trans.stalls else "false")
+
+        code('''
 // for adding information to the protocol debug trace
 stringstream ${ident}_transitionComment;
 
 #ifndef NDEBUG
-#define APPEND_TRANSITION_COMMENT(str) (${ident}_transitionComment << str)
+#define APPEND_TRANSITION_COMMENT(str) do { \\
+        if (DTRACE(ProtocolTrace)) \\
+            ${ident}_transitionComment << str; \\
+    } while (0)
 #else
 #define APPEND_TRANSITION_COMMENT(str) do {} while (0)
 #endif
@@ -547,7 +591,6 @@ if (m_${{param.ident}}_ptr != NULL) {
 
 for (int state = 0; state < ${ident}_State_NUM; state++) {
     for (int event = 0; event < ${ident}_Event_NUM; event++) {
-        m_possible[state][event] = false;
         m_counters[state][event] = 0;
     }
 }
@@ -645,21 +688,6 @@ $c_ident::init()
             # Set the queue consumers
             code('${{port.code}}.setConsumer(this);')
 
-        # Initialize the transition profiling
-        code()
-        for trans in self.transitions:
-            # Figure out if we stall
-            stall = False
-            for action in trans.actions:
-                if action.ident == "z_stall":
-                    stall = True
-
-            # Only possible if it is not a 'z' case
-            if not stall:
-                state = "%s_State_%s" % (self.ident, trans.state.ident)
-                event = "%s_Event_%s" % (self.ident, trans.event.ident)
-                code('possibleTransition($state, $event);')
-
         code.dedent()
         code('''
     AbstractController::init();
@@ -811,16 +839,10 @@ $c_ident::collateStats()
 void
 $c_ident::countTransition(${ident}_State state, ${ident}_Event event)
 {
-    assert(m_possible[state][event]);
+    assert(s_possible[state][event]);
     m_counters[state][event]++;
     m_event_counters[event]++;
 }
-void
-$c_ident::possibleTransition(${ident}_State state,
-                             ${ident}_Event event)
-{
-    m_possible[state][event] = true;
-}
 
 uint64_t
 $c_ident::getEventCount(${ident}_Event event)
@@ -831,7 +853,7 @@ $c_ident::getEventCount(${ident}_Event event)
 bool
 $c_ident::isPossible(${ident}_State state, ${ident}_Event event)
 {
-    return m_possible[state][event];
+    return s_possible[state][event];
 }
 
 uint64_t
@@ -1167,6 +1189,7 @@ ${ident}_Controller::wakeup()
 // ${ident}: ${{self.short}}
 
 #include <cassert>
+#include <cstdint>
 
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -1178,8 +1201,6 @@ ${ident}_Controller::wakeup()
 #include "mem/protocol/Types.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
-#define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
-
 #define GET_TRANSITION_COMMENT() (${ident}_transitionComment.str())
 #define CLEAR_TRANSITION_COMMENT() (${ident}_transitionComment.str(""))
 
@@ -1243,7 +1264,8 @@ if (result == TransitionResult_Valid) {
              ${ident}_State_to_string(next_state),
              printAddress(addr), GET_TRANSITION_COMMENT());
 
-    CLEAR_TRANSITION_COMMENT();
+    if (DTRACE(ProtocolTrace))
+        CLEAR_TRANSITION_COMMENT();
 ''')
         if self.TBEType != None and self.EntryType != None:
             code('setState(m_tbe_ptr, m_cache_entry_ptr, addr, next_state);')
@@ -1278,37 +1300,10 @@ if (result == TransitionResult_Valid) {
 
 return result;
 ''')
-        code.dedent()
-        code('''
-}
-
-TransitionResult
-${ident}_Controller::doTransitionWorker(${ident}_Event event,
-                                        ${ident}_State state,
-                                        ${ident}_State& next_state,
-''')
-
-        if self.TBEType != None:
-            code('''
-                                        ${{self.TBEType.c_ident}}*& m_tbe_ptr,
-''')
-        if self.EntryType != None:
-                  code('''
-                                        ${{self.EntryType.c_ident}}*& m_cache_entry_ptr,
-''')
-        code('''
-                                        Addr addr)
-{
-    switch(HASH_FUN(state, event)) {
-''')
-
         # This map will allow suppress generating duplicate code
         cases = orderdict()
 
         for trans in self.transitions:
-            case_string = "%s_State_%s, %s_Event_%s" % \
-                (self.ident, trans.state.ident, self.ident, trans.event.ident)
-
             case = self.symtab.codeFormatter()
             # Only set next_state if it changes
             if trans.state != trans.nextState:
@@ -1356,14 +1351,7 @@ if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
             for request_type in request_types:
                 case('recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);')
 
-            # Figure out if we stall
-            stall = False
-            for action in actions:
-                if action.ident == "z_stall":
-                    stall = True
-                    break
-
-            if stall:
+            if trans.stalls:
                 case('return TransitionResult_ProtocolStall;')
             else:
                 if self.TBEType != None and self.EntryType != None:
@@ -1386,15 +1374,53 @@ if (!checkResourceAvailable(%s_RequestType_%s, addr)) {
             if case not in cases:
                 cases[case] = []
 
-            cases[case].append(case_string)
+            cases[case].append(trans)
+
+        # Number the unique code blocks from 1 so that the switch over
+        # them is dense, 0 is left for invalid transitions
+        case_index = {}
+        for i,transitions in enumerate(cases.itervalues()):
+            for trans in transitions:
+                case_index[trans] = i + 1
+
+        code.dedent()
+        code('''
+}
+
+// Index of the code run by each transition, see doTransitionWorker()
+''')
+        self.printStateEventTable(code,
+            "static constexpr uint16_t %s_transitionCase" % ident,
+            lambda trans: str(case_index.get(trans, 0)))
+
+        code('''
+TransitionResult
+${ident}_Controller::doTransitionWorker(${ident}_Event event,
+                                        ${ident}_State state,
+                                        ${ident}_State& next_state,
+''')
+
+        if self.TBEType != None:
+            code('''
+                                        ${{self.TBEType.c_ident}}*& m_tbe_ptr,
+''')
+        if self.EntryType != None:
+                  code('''
+                                        ${{self.EntryType.c_ident}}*& m_cache_entry_ptr,
+''')
+        code('''
+                                        Addr addr)
+{
+    switch (${ident}_transitionCase[state][event]) {
+''')
 
         # Walk through all of the unique code blocks and spit out the
         # corresponding case statement elements
-        for case,transitions in cases.iteritems():
-            # Iterative over all the multiple transitions that share
-            # the same code
+        for i,(case,transitions) in enumerate(cases.iteritems()):
+            # List all the transitions that share the same code
             for trans in transitions:
-                code('  case HASH_FUN($trans):')
+                code('  // ${{trans.state.ident}}, ${{trans.event.ident}}')
+            code('  case ${{i + 1}}:')
             code('    $case\n')
 
         code('''
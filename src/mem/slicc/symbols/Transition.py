@@ -50,6 +50,8 @@ class Transition(Symbol):
         else:
             self.nextState = machine.states[nextState]
         self.actions = [ machine.actions[a] for a in actions ]
+        # Stalling transitions leave the state alone and aren't counted
+        self.stalls = any(a.ident == "z_stall" for a in self.actions)
         self.request_types = [ machine.request_types[s] for s in request_types ]
         self.resources = {}
 
@@ -45,9 +45,9 @@
 #ifndef __MEM_SNOOP_FILTER_HH__
 #define __MEM_SNOOP_FILTER_HH__
 
-#include <unordered_map>
 #include <utility>
 
+#include "base/flat_hash_map.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/qport.hh"
@@ -89,7 +89,7 @@ class SnoopFilter : public SimObject {
     typedef std::vector<QueuedSlavePort*> SnoopList;
 
     SnoopFilter (const SnoopFilterParams *p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()), retryItem{0, 0},
+        SimObject(p), reqLookupValid(false), retryItem{0, 0},
         linesize(p->system->cacheLineSize()), lookupLatency(p->lookup_latency),
         maxEntryCount(p->max_capacity / p->system->cacheLineSize())
     {
@@ -137,8 +137,8 @@ class SnoopFilter : public SimObject {
     /**
      * For an un-successful request, revert the change to the snoop
      * filter. Also take care of erasing any null entries. This method
-     * relies on the result from lookupRequest being stored in
-     * reqLookupResult.
+     * relies on lookupRequest having recorded whether it touched an
+     * entry in reqLookupValid.
      *
      * @param will_retry    This request will retry on this bus / snoop filter
      * @param addr          Packet address, merely for sanity checking
@@ -218,7 +218,7 @@ class SnoopFilter : public SimObject {
     /**
      * HashMap of SnoopItems indexed by line address
      */
-    typedef std::unordered_map<Addr, SnoopItem> SnoopFilterCache;
+    typedef FlatHashMap<Addr, SnoopItem> SnoopFilterCache;
 
     /**
      * Simple factory methods for standard return values.
@@ -261,10 +261,12 @@ class SnoopFilter : public SimObject {
     /** Simple hash set of cached addresses. */
     SnoopFilterCache cachedLocations;
     /**
-     * Iterator used to store the result from lookupRequest until we
-     * call finishRequest.
+     * Set when lookupRequest found or allocated an entry that
+     * finishRequest has to revisit. An iterator cannot be kept
+     * instead, as any insertion or erasure in between (e.g. from a
+     * snoop) may move entries in the open-addressed table.
      */
-    SnoopFilterCache::iterator reqLookupResult;
+    bool reqLookupValid;
     /**
      * Variable to temporarily store value of snoopfilter entry
      * incase finishRequest needs to undo changes made in lookupRequest
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/thread_bridge.hh"
+
+#include <algorithm>
+
+#include "base/trace.hh"
+#include "debug/Drain.hh"
+#include "debug/ThreadBridge.hh"
+#include "params/ThreadBridge.hh"
+
+ThreadBridge::Channel::Channel(ThreadBridge &_bridge, const std::string &name,
+                               EventQueue *_consumer, DeliverFn deliver)
+    : delay(0), bridge(_bridge), _name(name), consumer(_consumer),
+      deliverFn(deliver),
+      deliverEvent([this]{ this->deliver(); }, name),
+      waitingForRetry(false)
+{
+    consumer->addQuantumCallback(this);
+}
+
+void
+ThreadBridge::Channel::send(PacketPtr pkt)
+{
+    DPRINTF(ThreadBridge, "%s: send %s\n", _name, pkt->print());
+
+    ++bridge.inFlight;
+    inbox.push(Message(pkt, curTick(), curTick() + delay));
+}
+
+void
+ThreadBridge::Channel::process()
+{
+    // Only take packets sent before the barrier. Packets sent at the
+    // barrier tick may or may not have made it into the inbox
+    // depending on thread timing and are picked up next quantum.
+    const Tick now = curTick();
+    Message *msg;
+    while ((msg = inbox.front()) && msg->sendTick < now) {
+        pending.push_back(*msg);
+        inbox.pop();
+    }
+
+    scheduleDelivery();
+}
+
+void
+ThreadBridge::Channel::retry()
+{
+    assert(waitingForRetry);
+    waitingForRetry = false;
+    deliver();
+}
+
+bool
+ThreadBridge::Channel::trySatisfyFunctional(PacketPtr pkt)
+{
+    for (auto &msg : pending) {
+        if (pkt->trySatisfyFunctional(msg.pkt))
+            return true;
+    }
+    return false;
+}
+
+void
+ThreadBridge::Channel::deliver()
+{
+    while (!pending.empty() && !waitingForRetry &&
+           pending.front().deliverTick <= curTick()) {
+        const Message &msg = pending.front();
+        DPRINTF(ThreadBridge, "%s: deliver %s\n", _name, msg.pkt->print());
+
+        if (!deliverFn(msg)) {
+            waitingForRetry = true;
+            return;
+        }
+
+        pending.pop_front();
+        --bridge.inFlight;
+        bridge.packetDone();
+    }
+
+    scheduleDelivery();
+}
+
+void
+ThreadBridge::Channel::scheduleDelivery()
+{
+    if (pending.empty() || waitingForRetry || deliverEvent.scheduled())
+        return;
+
+    consumer->schedule(&deliverEvent,
+                       std::max(pending.front().deliverTick, curTick()));
+}
+
+ThreadBridge::ThreadBridge(const ThreadBridgeParams *p)
+    : MemObject(p),
+      slavePort(p->name + ".slave", *this),
+      masterPort(p->name + ".master", *this),
+      masterQueue(getEventQueue(p->master_eventq_index)),
+      reqChannel(*this, p->name + ".req", masterQueue,
+                 [this](const Message &msg) { return deliverReq(msg); }),
+      respChannel(*this, p->name + ".resp", eventQueue(),
+                  [this](const Message &msg) { return deliverResp(msg); }),
+      snoopReqChannel(*this, p->name + ".snoop_req", eventQueue(),
+                      [this](const Message &msg) {
+                          return deliverSnoopReq(msg);
+                      }),
+      minDelay(p->delay), reqLimit(p->req_size),
+      outstanding(0), retryReq(false), inFlight(0), drainSignalled(false)
+{
+    fatal_if(masterQueue == eventQueue(),
+             "%s: both sides are on event queue %d.\n",
+             name(), p->eventq_index);
+}
+
+void
+ThreadBridge::init()
+{
+    if (!slavePort.isConnected() || !masterPort.isConnected())
+        fatal("Thread bridge %s is not connected on both sides.\n", name());
+
+    slavePort.sendRangeChange();
+}
+
+void
+ThreadBridge::startup()
+{
+    // Packets are only handed over at quantum barriers, so nothing can
+    // cross the bridge faster than one quantum.
+    const Tick delay = std::max(minDelay, simQuantum);
+    if (delay > minDelay) {
+        inform("%s: latency raised to the simulation quantum (%llu).\n",
+               name(), delay);
+    }
+
+    reqChannel.delay = delay;
+    respChannel.delay = delay;
+    snoopReqChannel.delay = delay;
+}
+
+BaseMasterPort&
+ThreadBridge::getMasterPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "master")
+        return masterPort;
+    else
+        return MemObject::getMasterPort(if_name, idx);
+}
+
+BaseSlavePort&
+ThreadBridge::getSlavePort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "slave")
+        return slavePort;
+    else
+        return MemObject::getSlavePort(if_name, idx);
+}
+
+DrainState
+ThreadBridge::drain()
+{
+    if (inFlight == 0 && outstanding == 0)
+        return DrainState::Drained;
+
+    drainSignalled = false;
+    return DrainState::Draining;
+}
+
+void
+ThreadBridge::packetDone()
+{
+    // Both threads may find the bridge idle at the same time, only
+    // one of them may tell the drain manager.
+    if (drainState() == DrainState::Draining &&
+        inFlight == 0 && outstanding == 0 && !drainSignalled.exchange(true)) {
+        DPRINTF(Drain, "ThreadBridge done draining, signaling drain manager\n");
+        signalDrainDone();
+    }
+}
+
+bool
+ThreadBridge::deliverReq(const Message &msg)
+{
+    return masterPort.sendTimingReq(msg.pkt);
+}
+
+bool
+ThreadBridge::deliverResp(const Message &msg)
+{
+    if (!slavePort.sendTimingResp(msg.pkt))
+        return false;
+
+    assert(outstanding > 0);
+    --outstanding;
+
+    if (retryReq) {
+        retryReq = false;
+        slavePort.sendRetryReq();
+    }
+
+    return true;
+}
+
+bool
+ThreadBridge::deliverSnoopReq(const Message &msg)
+{
+    slavePort.sendTimingSnoopReq(msg.pkt);
+
+    // The crossbar has long moved on, nobody is left to hand a
+    // response or a sharer to.
+    panic_if(msg.pkt->cacheResponding() || msg.pkt->hasSharers(),
+             "%s: a cache above the bridge answered a snoop for %#x, "
+             "caches have to stay below thread bridges\n",
+             name(), msg.pkt->getAddr());
+
+    delete msg.pkt;
+    return true;
+}
+
+bool
+ThreadBridge::trySatisfyFunctional(PacketPtr pkt, bool master_side)
+{
+    // Packets that have been picked up by a side but not delivered yet
+    // may hold newer data than the memory system.
+    pkt->pushLabel(name());
+    bool done = master_side ?
+        reqChannel.trySatisfyFunctional(pkt) :
+        respChannel.trySatisfyFunctional(pkt);
+    pkt->popLabel();
+    return done;
+}
+
+Tick
+ThreadBridge::BridgeSlavePort::recvAtomic(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.masterQueue, inParallelMode);
+    return bridge.minDelay + bridge.masterPort.sendAtomic(pkt);
+}
+
+void
+ThreadBridge::BridgeSlavePort::recvFunctional(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.masterQueue, inParallelMode);
+
+    if (!bridge.trySatisfyFunctional(pkt, true))
+        bridge.masterPort.sendFunctional(pkt);
+}
+
+bool
+ThreadBridge::BridgeSlavePort::recvTimingReq(PacketPtr pkt)
+{
+    panic_if(pkt->cacheResponding(),
+             "%s: should not see packets where cache is responding\n",
+             name());
+
+    if (bridge.retryReq)
+        return false;
+
+    if (pkt->needsResponse()) {
+        if (bridge.outstanding >= bridge.reqLimit) {
+            DPRINTF(ThreadBridge, "Request limit reached, retry later\n");
+            bridge.retryReq = true;
+            return false;
+        }
+        ++bridge.outstanding;
+    }
+
+    bridge.reqChannel.send(pkt);
+    return true;
+}
+
+void
+ThreadBridge::BridgeSlavePort::recvRespRetry()
+{
+    bridge.respChannel.retry();
+}
+
+AddrRangeList
+ThreadBridge::BridgeSlavePort::getAddrRanges() const
+{
+    return bridge.masterPort.getAddrRanges();
+}
+
+bool
+ThreadBridge::BridgeMasterPort::recvTimingResp(PacketPtr pkt)
+{
+    bridge.respChannel.send(pkt);
+    return true;
+}
+
+void
+ThreadBridge::BridgeMasterPort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    // Nothing above the bridge responds to snoops, so the snooper can
+    // move on right away. Its packet may be gone by the time the copy
+    // is delivered.
+    bridge.snoopReqChannel.send(new Packet(pkt, true, false));
+}
+
+Tick
+ThreadBridge::BridgeMasterPort::recvAtomicSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(), inParallelMode);
+    return bridge.slavePort.sendAtomicSnoop(pkt);
+}
+
+void
+ThreadBridge::BridgeMasterPort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(), inParallelMode);
+
+    if (!bridge.trySatisfyFunctional(pkt, false))
+        bridge.slavePort.sendFunctionalSnoop(pkt);
+}
+
+void
+ThreadBridge::BridgeMasterPort::recvReqRetry()
+{
+    bridge.reqChannel.retry();
+}
+
+void
+ThreadBridge::BridgeMasterPort::recvRangeChange()
+{
+    bridge.slavePort.sendRangeChange();
+}
+
+bool
+ThreadBridge::BridgeMasterPort::isSnooping() const
+{
+    return bridge.slavePort.isSnooping();
+}
+
+ThreadBridge *
+ThreadBridgeParams::create()
+{
+    return new ThreadBridge(this);
+}
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_THREAD_BRIDGE_HH__
+#define __MEM_THREAD_BRIDGE_HH__
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <string>
+
+#include "base/callback.hh"
+#include "base/spsc_queue.hh"
+#include "mem/mem_object.hh"
+#include "mem/port.hh"
+#include "sim/eventq.hh"
+
+struct ThreadBridgeParams;
+
+/**
+ * A bridge between two event queues that are simulated by different
+ * threads. The slave side lives on the event queue of the bridge
+ * itself, the master side on the event queue selected by
+ * master_eventq_index. It is meant to sit between a CPU and the caches
+ * or crossbar below it.
+ *
+ * Timing requests, responses and snoop requests are handed over
+ * through lock-free single-producer single-consumer queues. The
+ * consuming side picks them up at the next quantum barrier and only
+ * accepts packets that were sent before the barrier, so the bridge
+ * latency is at least one simulation quantum and packets arrive in
+ * the same order whatever the timing of the threads.
+ *
+ * Snoop requests are copied and delivered a quantum late, so nothing
+ * above the bridge may respond to a snoop or hold a copy of a line:
+ * the masters above have to be CPUs, walkers or other non-caching
+ * devices, and the caches stay below the bridge on the event queue
+ * of the memory system.
+ */
+class ThreadBridge : public MemObject
+{
+  public:
+    ThreadBridge(const ThreadBridgeParams *p);
+
+    void init() override;
+    void startup() override;
+
+    DrainState drain() override;
+
+    BaseMasterPort& getMasterPort(const std::string &if_name,
+                                  PortID idx = InvalidPortID) override;
+    BaseSlavePort& getSlavePort(const std::string &if_name,
+                                PortID idx = InvalidPortID) override;
+
+  protected:
+    /** A packet in transit between the two event queues. */
+    struct Message
+    {
+        PacketPtr pkt;
+        /** Tick at which the producer sent the packet. */
+        Tick sendTick;
+        /** Tick at which the consumer delivers the packet. */
+        Tick deliverTick;
+
+        Message()
+            : pkt(nullptr), sendTick(0), deliverTick(0)
+        {}
+
+        Message(PacketPtr _pkt, Tick send, Tick deliver)
+            : pkt(_pkt), sendTick(send), deliverTick(deliver)
+        {}
+    };
+
+    /**
+     * One direction of the bridge. send() is called from the thread
+     * of the producing event queue; everything else runs on the
+     * thread of the consuming event queue.
+     */
+    class Channel : public Callback
+    {
+      public:
+        /** Deliver a packet, returns false if it has to be retried. */
+        typedef std::function<bool(const Message &)> DeliverFn;
+
+        Channel(ThreadBridge &bridge, const std::string &name,
+                EventQueue *consumer, DeliverFn deliver);
+
+        /** Hand a packet over to the consuming side. */
+        void send(PacketPtr pkt);
+
+        /** Pick up packets at a quantum barrier. */
+        void process() override;
+
+        /** The receiver is ready to accept the packet it refused. */
+        void retry();
+
+        /** Check packets that have not been delivered yet. */
+        bool trySatisfyFunctional(PacketPtr pkt);
+
+        /** Latency from send to delivery. */
+        Tick delay;
+
+      private:
+        void deliver();
+        void scheduleDelivery();
+
+        ThreadBridge &bridge;
+        const std::string _name;
+        EventQueue *const consumer;
+        const DeliverFn deliverFn;
+
+        /** Packets sent by the producer but not picked up yet. */
+        SPSCQueue<Message> inbox;
+
+        /** Packets picked up and waiting for their delivery tick. */
+        std::deque<Message> pending;
+
+        EventFunctionWrapper deliverEvent;
+
+        bool waitingForRetry;
+    };
+
+    class BridgeSlavePort : public SlavePort
+    {
+      public:
+        BridgeSlavePort(const std::string &_name, ThreadBridge &_bridge)
+            : SlavePort(_name, &_bridge), bridge(_bridge)
+        {}
+
+      protected:
+        Tick recvAtomic(PacketPtr pkt) override;
+        void recvFunctional(PacketPtr pkt) override;
+        bool recvTimingReq(PacketPtr pkt) override;
+        void recvRespRetry() override;
+        AddrRangeList getAddrRanges() const override;
+
+      private:
+        ThreadBridge &bridge;
+    };
+
+    class BridgeMasterPort : public MasterPort
+    {
+      public:
+        BridgeMasterPort(const std::string &_name, ThreadBridge &_bridge)
+            : MasterPort(_name, &_bridge), bridge(_bridge)
+        {}
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvTimingSnoopReq(PacketPtr pkt) override;
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+        void recvReqRetry() override;
+        void recvRangeChange() override;
+        bool isSnooping() const override;
+
+      private:
+        ThreadBridge &bridge;
+    };
+
+    bool deliverReq(const Message &msg);
+    bool deliverResp(const Message &msg);
+    bool deliverSnoopReq(const Message &msg);
+
+    /**
+     * Check the packets waiting for delivery on one side for a
+     * functional access. Must be called with that side's event queue
+     * locked.
+     */
+    bool trySatisfyFunctional(PacketPtr pkt, bool master_side);
+
+    /** Called on either side once a packet has left the bridge. */
+    void packetDone();
+
+    BridgeSlavePort slavePort;
+    BridgeMasterPort masterPort;
+
+    /** Event queue of the master side. */
+    EventQueue *const masterQueue;
+
+    /** Requests travelling from the slave to the master side. */
+    Channel reqChannel;
+
+    /** Responses travelling the other way. */
+    Channel respChannel;
+
+    /** Copies of snoop requests travelling from the master side to the
+     * slave side. */
+    Channel snoopReqChannel;
+
+    /** Minimum latency through the bridge in either direction. */
+    const Tick minDelay;
+
+    /** Maximum number of requests awaiting a response. */
+    const unsigned reqLimit;
+
+    /** Requests accepted by the slave side without a response yet. */
+    std::atomic<unsigned> outstanding;
+
+    /** Set when a request was refused and the sender awaits a retry. */
+    bool retryReq;
+
+    /** Packets in either channel, updated by both threads. */
+    std::atomic<unsigned> inFlight;
+
+    /** Guards against signalling the end of a drain twice. */
+    std::atomic<bool> drainSignalled;
+};
+
+#endif // __MEM_THREAD_BRIDGE_HH__
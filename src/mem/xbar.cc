@@ -352,6 +352,14 @@ BaseXBar::findPort(AddrRange addr_range)
           name());
 }
 
+void
+BaseXBar::recvBackdoorInvalidate(const AddrRange &range)
+{
+    DPRINTF(AddrRanges, "Revoking backdoors to %s\n", range.to_string());
+    for (const auto& p: slavePorts)
+        p->sendBackdoorInvalidate(range);
+}
+
 /** Function called by the port when the crossbar is receiving a range change.*/
 void
 BaseXBar::recvRangeChange(PortID master_port_id)
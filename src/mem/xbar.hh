@@ -52,9 +52,9 @@
 #define __MEM_XBAR_HH__
 
 #include <deque>
-#include <unordered_map>
 
 #include "base/addr_range_map.hh"
+#include "base/flat_hash_map.hh"
 #include "base/types.hh"
 #include "mem/mem_object.hh"
 #include "mem/qport.hh"
@@ -327,7 +327,7 @@ class BaseXBar : public MemObject
      * the underlying Request pointer inside the Packet stays
      * constant.
      */
-    std::unordered_map<RequestPtr, PortID> routeTo;
+    FlatHashMap<RequestPtr, PortID> routeTo;
 
     /** all contigous ranges seen by this crossbar */
     AddrRangeList xbarRanges;
@@ -342,6 +342,14 @@ class BaseXBar : public MemObject
      */
     virtual void recvRangeChange(PortID master_port_id);
 
+    /**
+     * Function called by the port when a slave below revokes
+     * backdoors. The revocation is passed on to all masters.
+     *
+     * @param range Address range of the revoked backdoors
+     */
+    void recvBackdoorInvalidate(const AddrRange &range);
+
     /**
      * Find which port connected to this crossbar (if any) should be
      * given a packet with this address range.
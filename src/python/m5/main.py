@@ -105,6 +105,16 @@ def parse_options():
     group("Statistics Options")
     option("--stats-file", metavar="FILE", default="stats.txt",
         help="Sets the output file for statistics [Default: %default]")
+    option("--stats-live", metavar="NAME", default=None,
+        help="Publish live statistics in shared memory segment NAME, "
+             "see util/live_stats.py")
+    option("--stats-live-interval", metavar="SECONDS", type='float',
+        default=1.0,
+        help="Host time between live statistics updates [Default: %default]")
+    option("--stats-live-stats", metavar="STAT[,STAT]", action='append',
+        split=',',
+        help="Statistics to publish live, shell patterns allowed "
+             "[Default: sim_insts, host_inst_rate, cache miss rates]")
 
     # Configuration Options
     group("Configuration Options")
@@ -117,6 +127,15 @@ def parse_options():
     option("--dot-dvfs-config", metavar="FILE", default=None,
         help="Create DOT & pdf outputs of the DVFS configuration" + \
              " [Default: %default]")
+    option("--save-config", metavar="FILE", default=None,
+        help="Save the elaborated configuration as an indexed binary " \
+             "file that util/cxx_config can start from without Python " \
+             "[Default: %default]")
+    option("--checkpoint-format", metavar="{ini,binary}",
+        choices=("ini", "binary"), default="ini",
+        help="Write checkpoints as ini (m5.cpt) or indexed binary (m5.cpb, " \
+             "faster to restore but not readable by cpt_upgrader.py) " \
+             "[Default: %default]")
 
     # Debugging options
     group("Debugging Options")
@@ -133,11 +152,25 @@ def parse_options():
         help="End debug output at TICK")
     option("--debug-file", metavar="FILE", default="cout",
         help="Sets the output file for debug [Default: %default]")
+    option("--debug-binary", action='store_true',
+        help="Record debug output in binary, without formatting it. " \
+             "Render it with util/decode_trace.py")
+    option("--debug-ring", metavar="N", type='int',
+        help="Keep the last N debug messages of each thread in memory, " \
+             "and only write them to --debug-file [Default: " \
+             "debug-ring.trc] in binary on panic, fatal or a crash")
     option("--debug-ignore", metavar="EXPR", action='append', split=':',
         help="Ignore EXPR sim objects")
     option("--remote-gdb-port", type='int', default=7000,
         help="Remote gdb base port (set to 0 to disable listening)")
 
+    # Simulation kernel options
+    group("Simulation Kernel Options")
+    option("--event-queue", metavar="{list,calendar}",
+        choices=("list", "calendar"), default="list",
+        help="Data structure used to order pending events " \
+        "[Default: %default]")
+
     # Help options
     group("Help Options")
     option("--list-sim-objects", action='store_true', default=False,
@@ -220,6 +253,7 @@ def main(*args):
         fatal("Tracing is not enabled.  Compile with TRACING_ON")
 
     # Set the main event queue for the main thread.
+    event.useCalendarEventQueue(options.event_queue == "calendar")
     event.mainq = event.getEventQueue(0)
     event.setEventQueue(event.mainq)
 
@@ -337,12 +371,16 @@ def main(*args):
 
     # tell C++ about output directory
     core.setOutputDir(options.outdir)
+    core.setBinaryCheckpoints(options.checkpoint_format == "binary")
 
     # update the system path with elements from the -p option
     sys.path[0:0] = options.path
 
     # set stats options
     stats.addStatVisitor(options.stats_file)
+    if options.stats_live:
+        stats.addLiveExport(options.stats_live, options.stats_live_stats,
+                            options.stats_live_interval)
 
     # Disable listeners unless running interactively or explicitly
     # enabled
@@ -397,7 +435,17 @@ def main(*args):
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    if options.debug_ring:
+        debug_file = options.debug_file
+        if debug_file in ('cout', 'cerr'):
+            debug_file = "debug-ring.trc"
+        trace.ringOutput(debug_file, options.debug_ring)
+    elif options.debug_binary:
+        if options.debug_file in ('cout', 'cerr'):
+            fatal("--debug-binary needs a --debug-file")
+        trace.binaryOutput(options.debug_file)
+    else:
+        trace.output(options.debug_file)
 
     for ignore in options.debug_ignore:
         check_tracing()
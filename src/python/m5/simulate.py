@@ -43,12 +43,16 @@
 from __future__ import print_function
 
 import atexit
+import multiprocessing
 import os
 import sys
+import traceback
+from StringIO import StringIO
 
 # import the wrapped C++ functions
 import _m5.drain
 import _m5.core
+import _m5.event
 from _m5.stats import updateEvents as updateStatEvents
 
 import stats
@@ -98,6 +102,15 @@ def instantiate(ckpt_dir=None):
             obj.print_ini(ini_file)
         ini_file.close()
 
+    if options.save_config:
+        # Same contents as config.ini, indexed for quick lookups
+        ini = StringIO()
+        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+            obj.print_ini(ini)
+        path = os.path.join(options.outdir, options.save_config)
+        if not _m5.core.writeIndexedIni(ini.getvalue(), path):
+            fatal("Unable to write configuration to %s" % path)
+
     if options.json_config:
         try:
             import json
@@ -356,6 +369,8 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
         # In child, notify objects of the fork
         root = objects.Root.getInstance()
         notifyFork(root)
+        # Only this thread lives on in the child
+        _m5.event.restartSimThreads()
         # Setup a new output directory
         parent = options.outdir
         options.outdir = simout % {
@@ -369,6 +384,86 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
 
     return pid
 
+# Samples started by forkSample() that haven't been waited for, oldest
+# first
+_running_samples = []
+
+def waitForkedSamples(max_running=0):
+    """Wait for samples started by forkSample() to finish.
+
+    Keyword Arguments:
+      max_running -- Return once no more than this many samples are
+                     still running.
+
+    Return Value:
+      List of (pid, exit status) of the samples that finished.
+    """
+
+    finished = []
+    # Only wait for our own samples, other children belong to
+    # whoever started them. Collect the samples that are done, then
+    # block on the oldest ones.
+    for pid in list(_running_samples):
+        done, status = os.waitpid(pid, os.WNOHANG)
+        if done:
+            _running_samples.remove(pid)
+            finished.append((pid, status))
+    while len(_running_samples) > max_running:
+        pid = _running_samples.pop(0)
+        finished.append((pid, os.waitpid(pid, 0)[1]))
+    return finished
+
+def forkSample(system, cpuList, window, warmup=0, max_running=None,
+               simout="%(parent)s.sample%(fork_seq)i"):
+    """Measure a sample of the execution in a forked simulator.
+
+    The simulator drains and forks. The child switches to the new CPUs
+    of cpuList (see switchCpus()), simulates warmup ticks, resets the
+    stats, simulates window ticks, dumps the stats to its own output
+    directory and exits. The parent carries on right away, so it can
+    keep fast-forwarding while the sample runs. The backing stores of
+    the memories are private mappings, which the child shares with the
+    parent copy-on-write.
+
+    Keyword Arguments:
+      warmup -- Ticks to simulate before measuring.
+      max_running -- Maximum number of samples running at once. Wait
+                     for one to finish when there are that many.
+                     [Default: number of host CPUs]
+      simout -- Output directory of the sample, see fork().
+
+    Return Value:
+      pid of the sample.
+    """
+
+    if max_running is None:
+        max_running = multiprocessing.cpu_count()
+    waitForkedSamples(max(max_running - 1, 0))
+
+    pid = fork(simout)
+    if pid:
+        _running_samples.append(pid)
+        return pid
+
+    code = 0
+    try:
+        switchCpus(system, cpuList)
+        if warmup:
+            simulate(warmup)
+        stats.reset()
+        exit_event = simulate(window)
+        stats.dump()
+        print("Sample ended @ tick %i because %s" %
+              (_m5.core.curTick(), exit_event.getCause()))
+    except:
+        traceback.print_exc()
+        code = 1
+    finally:
+        sys.stdout.flush()
+        sys.stderr.flush()
+        # The exit handlers belong to the parent's run, leave them out
+        os._exit(code)
+
 from _m5.core import disableAllListeners, listenersDisabled
 from _m5.core import listenersLoopbackOnly
 from _m5.core import curTick
@@ -102,24 +102,44 @@ def _url_factory(func):
     return wrapper
 
 @_url_factory
-def _textFactory(fn, desc=True):
+def _textFactory(fn, desc=True, skip_unchanged=False):
     """Output stats in text format.
 
     Text stat files contain one stat per line with an optional
     description. The description is enabled by default, but can be
-    disabled by setting the desc parameter to False.
+    disabled by setting the desc parameter to False. Setting the
+    skip_unchanged parameter to True leaves out the stats that were
+    not written since the previous dump, which keeps frequent interval
+    dumps small.
 
-    Example: text://stats.txt?desc=False
+    Example: text://stats.txt?desc=False;skip_unchanged=True
 
     """
 
-    return _m5.stats.initText(fn, desc)
+    return _m5.stats.initText(fn, desc, skip_unchanged)
+
+@_url_factory
+def _binaryFactory(fn, compress=False):
+    """Output stats in a binary columnar format.
+
+    Binary stat files hold a dictionary of the stats followed by one
+    row of values per dump. They are much cheaper to write than text
+    files and can be loaded, or converted to the text format, using
+    util/stats_bin.py. Set the compress parameter to True to compress
+    the file with zlib.
+
+    Example: binary://stats.bin?compress=True
+
+    """
+
+    return _m5.stats.initBinary(fn, compress)
 
 factories = {
     # Default to the text factory if we're given a naked path
     "" : _textFactory,
     "file" : _textFactory,
     "text" : _textFactory,
+    "binary" : _binaryFactory,
 }
 
 def addStatVisitor(url):
@@ -146,6 +166,30 @@ def addStatVisitor(url):
 
     outputList.append(factory(parsed))
 
+# Stats published by default by addLiveExport
+defaultLiveStats = [
+    "sim_insts",
+    "sim_ticks",
+    "host_inst_rate",
+    "*.overall_miss_rate",
+    "*.overallAliasCacheMissRate",
+    "*.overallCapabilityCacheMissRate",
+]
+
+liveExport = None
+def addLiveExport(name, stats=None, interval=1.0):
+    """Publish stats in a shared memory segment while simulating.
+
+    The segment is updated every interval seconds of host time and can
+    be read with util/live_stats.py. Stats are selected by name, with
+    fnmatch style patterns. Vectors and formulas are published as their
+    total unless an element is selected with name::subname.
+
+    """
+
+    global liveExport
+    liveExport = (name, stats or defaultLiveStats, interval)
+
 def initSimStats():
     _m5.stats.initSimStats()
     _m5.stats.registerPythonStatsHandlers()
@@ -181,6 +225,9 @@ def enable():
 
     _m5.stats.enable();
 
+    if liveExport:
+        _m5.stats.initLiveStats(*liveExport)
+
 def prepare():
     '''Prepare all stats for data access.  This must be done before
     dumping and serialization.'''
@@ -49,8 +49,10 @@
 #include "python/pybind11/core.hh"
 
 #include <ctime>
+#include <sstream>
 
 #include "base/addr_range.hh"
+#include "base/indexed_ini.hh"
 #include "base/inet.hh"
 #include "base/logging.hh"
 #include "base/random.hh"
@@ -264,6 +266,15 @@ pybind_init_core(py::module &m_native)
      */
     m_core
         .def("serializeAll", &Serializable::serializeAll)
+        .def("setBinaryCheckpoints", [](bool binary) {
+                Serializable::binaryCheckpoints = binary;
+            })
+        .def("writeIndexedIni", [](const std::string &ini,
+                                   const std::string &filename) {
+                std::istringstream is(ini);
+                IndexedIni::Writer writer;
+                return writer.load(is) && writer.write(filename);
+            })
         .def("unserializeGlobals", &Serializable::unserializeGlobals)
         .def("getCheckpoint", [](const std::string &cpt_dir) {
             return new CheckpointIn(cpt_dir, pybindSimObjectResolver);
@@ -70,6 +70,18 @@ output(const char *filename)
     Trace::setDebugLogger(new Trace::OstreamLogger(*file_stream->stream()));
 }
 
+static void
+binaryOutput(const char *filename)
+{
+    Trace::setDebugLogger(new Trace::BinaryLogger(filename));
+}
+
+static void
+ringOutput(const char *filename, size_t size)
+{
+    Trace::setDebugLogger(new Trace::RingLogger(filename, size));
+}
+
 static void
 ignore(const char *expr)
 {
@@ -112,6 +124,8 @@ pybind_init_debug(py::module &m_native)
     py::module m_trace = m_native.def_submodule("trace");
     m_trace
         .def("output", &output)
+        .def("binaryOutput", &binaryOutput)
+        .def("ringOutput", &ringOutput)
         .def("ignore", &ignore)
         .def("enable", &Trace::enable)
         .def("disable", &Trace::disable)
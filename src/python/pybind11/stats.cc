@@ -45,7 +45,9 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/binary.hh"
 #include "base/stats/text.hh"
+#include "sim/live_stats.hh"
 #include "sim/stat_control.hh"
 #include "sim/stat_register.hh"
 
@@ -77,10 +79,13 @@ pybind_init_stats(py::module &m_native)
     m
         .def("initSimStats", &Stats::initSimStats)
         .def("initText", &Stats::initText, py::return_value_policy::reference)
+        .def("initBinary", &Stats::initBinary,
+             py::return_value_policy::reference)
         .def("registerPythonStatsHandlers",
              &Stats::registerPythonStatsHandlers)
         .def("schedStatEvent", &Stats::schedStatEvent)
         .def("periodicStatDump", &Stats::periodicStatDump)
+        .def("initLiveStats", &Stats::initLiveStats)
         .def("updateEvents", &Stats::updateEvents)
         .def("processResetQueue", &Stats::processResetQueue)
         .def("processDumpQueue", &Stats::processDumpQueue)
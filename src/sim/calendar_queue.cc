@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/calendar_queue.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/eventq.hh"
+
+CalendarQueue::CalendarQueue()
+    : buckets(minBuckets, nullptr), widthShift(9), scanTick(0),
+      numBins(0), _head(nullptr)
+{
+}
+
+void
+CalendarQueue::insert(Event *event)
+{
+    // Find the first bin in the bucket that does not come before the
+    // event; that is either the event's own bin or its successor.
+    Event **link = &buckets[bucketOf(event->when())];
+    while (*link && **link < *event)
+        link = &(*link)->nextBin;
+
+    Event *curr = *link;
+    if (!curr || *event < *curr)
+        numBins++;
+    *link = Event::insertBefore(event, curr);
+
+    if (event->when() < scanTick)
+        scanTick = event->when();
+
+    if (!_head || *event <= *_head)
+        _head = event;
+
+    if (numBins > 2 * buckets.size())
+        resize(2 * buckets.size());
+}
+
+void
+CalendarQueue::remove(Event *event)
+{
+    Event **link = &buckets[bucketOf(event->when())];
+    while (*link && **link < *event)
+        link = &(*link)->nextBin;
+
+    Event *top = *link;
+    if (!top || *top != *event)
+        panic("event not found!");
+
+    bool bin_removed = event == top && !top->nextInBin;
+    *link = Event::removeItem(event, top);
+
+    if (bin_removed)
+        numBins--;
+
+    if (numBins < buckets.size() / 2 && buckets.size() > minBuckets) {
+        // Resizing recomputes the head as well.
+        resize(buckets.size() / 2);
+    } else if (event == _head) {
+        _head = bin_removed ? findHead() : *link;
+    }
+}
+
+Event *
+CalendarQueue::findHead()
+{
+    if (numBins == 0)
+        return nullptr;
+
+    // Walk the calendar one bucket (day) at a time starting at the
+    // earliest possible tick. The first bin of a bucket is the earliest
+    // one in it, and it is due if it falls within the current year.
+    Tick slot = scanTick >> widthShift;
+    for (size_t i = 0; i < buckets.size(); ++i, ++slot) {
+        Event *bin = buckets[slot & (buckets.size() - 1)];
+        if (bin && (bin->when() >> widthShift) == slot) {
+            scanTick = bin->when();
+            return bin;
+        }
+    }
+
+    // Nothing is due within a year, so the remaining bins are sparse.
+    // Fall back to a direct search of the earliest bin in each bucket.
+    Event *best = nullptr;
+    for (auto bin : buckets) {
+        if (bin && (!best || *bin < *best))
+            best = bin;
+    }
+
+    scanTick = best->when();
+    return best;
+}
+
+std::vector<Event *>
+CalendarQueue::sortedBins() const
+{
+    std::vector<Event *> bins;
+    bins.reserve(numBins);
+    for (auto bin : buckets) {
+        for (; bin; bin = bin->nextBin)
+            bins.push_back(bin);
+    }
+
+    std::sort(bins.begin(), bins.end(),
+              [](const Event *l, const Event *r) { return *l < *r; });
+    return bins;
+}
+
+void
+CalendarQueue::resize(size_t num_buckets)
+{
+    std::vector<Event *> bins = sortedBins();
+
+    // Estimate the bucket width from the average separation of the
+    // earliest ticks, ignoring outliers more than twice the average
+    // apart, and make a bucket about three times as wide.
+    std::vector<Tick> gaps;
+    for (size_t i = 1; i < bins.size() && gaps.size() < widthSamples; ++i) {
+        Tick gap = bins[i]->when() - bins[i - 1]->when();
+        if (gap)
+            gaps.push_back(gap);
+    }
+
+    if (!gaps.empty()) {
+        Tick sum = 0;
+        for (auto gap : gaps)
+            sum += std::min(gap, MaxTick / widthSamples);
+        Tick avg = sum / gaps.size();
+
+        Tick near_sum = 0;
+        size_t near_count = 0;
+        for (auto gap : gaps) {
+            if (gap <= 2 * avg) {
+                near_sum += gap;
+                near_count++;
+            }
+        }
+        if (near_count)
+            avg = near_sum / near_count;
+
+        widthShift = ceilLog2(std::max<Tick>(3 * avg, 1));
+    }
+
+    buckets.assign(num_buckets, nullptr);
+    std::vector<Event *> tails(num_buckets, nullptr);
+    for (auto bin : bins) {
+        size_t idx = bucketOf(bin->when());
+        bin->nextBin = nullptr;
+        if (tails[idx])
+            tails[idx]->nextBin = bin;
+        else
+            buckets[idx] = bin;
+        tails[idx] = bin;
+    }
+
+    _head = bins.empty() ? nullptr : bins.front();
+    if (_head)
+        scanTick = _head->when();
+}
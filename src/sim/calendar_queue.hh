@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Calendar queue backend for EventQueue
+ */
+
+#ifndef __SIM_CALENDAR_QUEUE_HH__
+#define __SIM_CALENDAR_QUEUE_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+
+class Event;
+
+/**
+ * A calendar queue (R. Brown, CACM 1988) of event bins. A bin holds all
+ * events with the same when() and priority() as a LIFO stack linked
+ * through Event::nextInBin, exactly like the bins of the linked list
+ * EventQueue, so the order in which events are serviced is identical.
+ *
+ * Bins are hashed into a power-of-two number of buckets by their tick
+ * divided by the bucket width. Each bucket is a list of bins sorted by
+ * (when, priority), linked through Event::nextBin. The number of
+ * buckets tracks the number of bins and the bucket width is re-estimated
+ * from the spacing of the earliest bins whenever the queue is resized,
+ * so inserting, removing and dequeueing take amortized constant time
+ * independently of the number of pending ticks.
+ */
+class CalendarQueue
+{
+  public:
+    CalendarQueue();
+
+    /** Insert an event, pushing it on its bin if the bin exists. */
+    void insert(Event *event);
+
+    /** Remove a scheduled event from its bin. */
+    void remove(Event *event);
+
+    /** The top of the earliest bin, i.e. the next event to service. */
+    Event *head() const { return _head; }
+
+    bool empty() const { return _head == nullptr; }
+
+    /** The top events of all bins in (when, priority) order. */
+    std::vector<Event *> sortedBins() const;
+
+  private:
+    /** Smallest and initial number of buckets. */
+    static const size_t minBuckets = 16;
+
+    /** Number of earliest bins used to estimate the bucket width. */
+    static const size_t widthSamples = 32;
+
+    /** Buckets of bins, sorted by (when, priority). */
+    std::vector<Event *> buckets;
+
+    /** log2 of the bucket width in ticks. */
+    unsigned widthShift;
+
+    /** Lower bound on the tick of every bin in the queue. */
+    Tick scanTick;
+
+    /** Number of bins (not events) in the queue. */
+    size_t numBins;
+
+    /** Cached top of the earliest bin. */
+    Event *_head;
+
+    size_t bucketOf(Tick when) const
+    {
+        return (when >> widthShift) & (buckets.size() - 1);
+    }
+
+    /** Locate the earliest bin, starting the search at scanTick. */
+    Event *findHead();
+
+    /** Rehash all bins into the given number of buckets. */
+    void resize(size_t num_buckets);
+};
+
+#endif // __SIM_CALENDAR_QUEUE_HH__
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_pool.hh"
+
+#ifdef EVENT_ALLOC_STATS
+
+#include <cxxabi.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.hh"
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/eventq.hh"
+
+namespace
+{
+
+/** Number of allocators listed in the report. */
+const size_t reportTop = 25;
+
+struct PoolCount
+{
+    uint64_t allocs;
+    uint64_t reused;
+
+    PoolCount() : allocs(0), reused(0) {}
+};
+
+std::mutex statsMutex;
+std::map<std::string, uint64_t> releases;
+std::map<std::string, PoolCount> pools;
+bool reportRegistered = false;
+
+std::string
+demangle(const char *name)
+{
+    int status;
+    char *s = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (!s)
+        return name;
+    std::string result(s);
+    std::free(s);
+    return result;
+}
+
+void
+report()
+{
+    OutputStream *os = simout.create("event_allocs.txt");
+    std::ostream &out = *os->stream();
+
+    std::vector<std::pair<uint64_t, std::string>> sorted;
+    for (const auto &r : releases)
+        sorted.emplace_back(r.second, r.first);
+    std::sort(sorted.rbegin(), sorted.rend());
+    if (sorted.size() > reportTop)
+        sorted.resize(reportTop);
+
+    ccprintf(out, "# Events deleted after being serviced\n");
+    for (const auto &r : sorted)
+        ccprintf(out, "%12d %s\n", r.first, r.second);
+
+    ccprintf(out, "\n# Pool allocations (total, reused)\n");
+    for (const auto &p : pools) {
+        ccprintf(out, "%12d %12d %s\n", p.second.allocs, p.second.reused,
+                 p.first);
+    }
+
+    simout.close(os);
+}
+
+struct ReportCallback : public Callback
+{
+    void process() override { report(); }
+};
+
+void
+registerReport()
+{
+    if (!reportRegistered) {
+        registerExitCallback(new ReportCallback);
+        reportRegistered = true;
+    }
+}
+
+} // anonymous namespace
+
+void
+recordEventPoolAlloc(const std::type_info &type, bool reused)
+{
+    std::lock_guard<std::mutex> lock(statsMutex);
+    registerReport();
+
+    PoolCount &count = pools[demangle(type.name())];
+    count.allocs++;
+    if (reused)
+        count.reused++;
+}
+
+void
+recordEventRelease(const Event *event)
+{
+    // Events that don't override name() have a unique default name,
+    // group them by their description instead.
+    std::string key = event->name();
+    if (key.compare(0, 6, "Event_") == 0)
+        key = event->description();
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    registerReport();
+    releases[key]++;
+}
+
+#endif // EVENT_ALLOC_STATS
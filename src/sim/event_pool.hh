@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_POOL_HH__
+#define __SIM_EVENT_POOL_HH__
+
+#include <cstddef>
+#include <new>
+
+#include "base/pool_allocator.hh"
+
+#ifdef EVENT_ALLOC_STATS
+#include <typeinfo>
+
+/** Count an allocation from an event pool. */
+void recordEventPoolAlloc(const std::type_info &type, bool reused);
+#endif
+
+/**
+ * Per-thread free list allocator for events that are created and
+ * deleted at a high rate, e.g. auto-delete events scheduled once per
+ * packet or instruction.
+ *
+ * Deriving an event class T from EventPool<T> makes new and delete of
+ * T use the per-thread BlockPool of its size, so the heap is only used
+ * while the pool grows. Objects
+ * of classes derived from T have a different size and use the global
+ * heap.
+ */
+template <class T>
+class EventPool
+{
+  public:
+    static void *
+    operator new(size_t size)
+    {
+        if (size != sizeof(T))
+            return ::operator new(size);
+
+#ifdef EVENT_ALLOC_STATS
+        recordEventPoolAlloc(typeid(T), BlockPool<sizeof(T)>::hasFree());
+#endif
+        return BlockPool<sizeof(T)>::allocate();
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size != sizeof(T))
+            ::operator delete(p);
+        else
+            BlockPool<sizeof(T)>::release(p);
+    }
+};
+
+#endif // __SIM_EVENT_POOL_HH__
@@ -42,6 +42,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/calendar_queue.hh"
 #include "sim/core.hh"
 #include "sim/eventq_impl.hh"
 
@@ -59,6 +60,7 @@ uint32_t numMainEventQueues = 0;
 vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
+bool useCalendarEventQueue = false;
 
 EventQueue *
 getEventQueue(uint32_t index)
@@ -117,6 +119,12 @@ Event::insertBefore(Event *event, Event *curr)
 void
 EventQueue::insert(Event *event)
 {
+    if (calendar) {
+        calendar->insert(event);
+        head = calendar->head();
+        return;
+    }
+
     // Deal with the head case
     if (!head || *event <= *head) {
         head = Event::insertBefore(event, head);
@@ -176,6 +184,12 @@ EventQueue::remove(Event *event)
 
     assert(event->queue == this);
 
+    if (calendar) {
+        calendar->remove(event);
+        head = calendar->head();
+        return;
+    }
+
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
@@ -208,7 +222,11 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
-    if (next) {
+    if (calendar) {
+        // The head is the first bin of its bucket, so this is cheap.
+        calendar->remove(event);
+        head = calendar->head();
+    } else if (next) {
         // update the next bin pointer since it could be stale
         next->nextBin = head->nextBin;
 
@@ -300,15 +318,12 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
-            Event *nextInBin = nextBin;
+        for (auto bin : bins()) {
+            Event *nextInBin = bin;
             while (nextInBin) {
                 nextInBin->dump();
                 nextInBin = nextInBin->nextInBin;
             }
-
-            nextBin = nextBin->nextBin;
         }
     }
 
@@ -323,8 +338,7 @@ EventQueue::debugVerify() const
     Tick time = 0;
     short priority = 0;
 
-    Event *nextBin = head;
-    while (nextBin) {
+    for (auto nextBin : bins()) {
         Event *nextInBin = nextBin;
         while (nextInBin) {
             if (nextInBin->when() < time) {
@@ -350,17 +364,46 @@ EventQueue::debugVerify() const
 
             nextInBin = nextInBin->nextInBin;
         }
-
-        nextBin = nextBin->nextBin;
     }
 
     return true;
 }
 
+std::vector<Event *>
+EventQueue::bins() const
+{
+    if (calendar)
+        return calendar->sortedBins();
+
+    std::vector<Event *> list;
+    for (Event *bin = head; bin; bin = bin->nextBin)
+        list.push_back(bin);
+    return list;
+}
+
 Event*
 EventQueue::replaceHead(Event* s)
 {
     Event* t = head;
+    if (calendar) {
+        // The calendar cannot be rebuilt from a head pointer, so set the
+        // whole calendar aside and bring it back when the head is
+        // restored.
+        if (!s) {
+            panic_if(savedCalendar, "Event queue head replaced twice.\n");
+            savedCalendar = calendar;
+            calendar = new CalendarQueue;
+        } else {
+            panic_if(!savedCalendar || savedCalendar->head() != s,
+                     "Restoring an unknown event queue head.\n");
+            delete calendar;
+            calendar = savedCalendar;
+            savedCalendar = nullptr;
+        }
+        head = calendar->head();
+        return t;
+    }
+
     head = s;
     return t;
 }
@@ -380,6 +423,37 @@ Event::description() const
     return "generic";
 }
 
+void
+PeriodicEvent::start(EventQueue *q, Tick when, Tick period)
+{
+    assert(period > 0);
+    if (scheduled())
+        eventq->deschedule(this);
+
+    eventq = q;
+    _period = period;
+    running = true;
+    eventq->schedule(this, when);
+}
+
+void
+PeriodicEvent::stop()
+{
+    running = false;
+    if (scheduled())
+        eventq->deschedule(this);
+}
+
+void
+PeriodicEvent::process()
+{
+    callback();
+
+    // The callback may have stopped or restarted the event.
+    if (running && !scheduled())
+        eventq->schedule(this, when() + _period);
+}
+
 void
 Event::trace(const char *action)
 {
@@ -414,10 +488,18 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0),
+      calendar(useCalendarEventQueue ? new CalendarQueue : nullptr),
+      savedCalendar(nullptr)
 {
 }
 
+EventQueue::~EventQueue()
+{
+    delete calendar;
+    delete savedCalendar;
+}
+
 void
 EventQueue::asyncInsert(Event *event)
 {
@@ -438,4 +520,6 @@ EventQueue::handleAsyncInsertions()
     }
 
     async_queue_mutex.unlock();
+
+    quantumCallbacks.process();
 }
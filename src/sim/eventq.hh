@@ -46,13 +46,23 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
+#include "base/callback.hh"
 #include "base/flags.hh"
 #include "base/types.hh"
 #include "debug/Event.hh"
+#include "sim/event_pool.hh"
 #include "sim/serialize.hh"
 
+class CalendarQueue;
 class EventQueue;       // forward declaration
+class Event;
+
+#ifdef EVENT_ALLOC_STATS
+/** Count the deletion of a managed event after it left the queue. */
+void recordEventRelease(const Event *event);
+#endif
 class BaseGlobalEvent;
 
 //! Simulation Quantum for multiple eventq simulation.
@@ -76,6 +86,10 @@ extern __thread EventQueue *_curEventQueue;
 //! Current mode of execution: parallel / serial
 extern bool inParallelMode;
 
+//! Whether newly created event queues order their events with a
+//! calendar queue instead of the default sorted list of bins.
+extern bool useCalendarEventQueue;
+
 //! Function for returning eventq queue for the provided
 //! index. The function allocates a new queue in case one
 //! does not exist for the index, provided that the index
@@ -185,6 +199,7 @@ class EventBase
  */
 class Event : public EventBase, public Serializable
 {
+    friend class CalendarQueue;
     friend class EventQueue;
 
   private:
@@ -327,8 +342,12 @@ class Event : public EventBase, public Serializable
     virtual void acquireImpl() {}
 
     virtual void releaseImpl() {
-        if (!scheduled())
+        if (!scheduled()) {
+#ifdef EVENT_ALLOC_STATS
+            recordEventRelease(this);
+#endif
             delete this;
+        }
     }
 
     /** @} */
@@ -493,12 +512,23 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+    //! Calendar queue holding the events when the queue uses the
+    //! calendar backend, NULL for the linked list of bins. The head
+    //! pointer always mirrors the calendar's earliest event.
+    CalendarQueue *calendar;
+
+    //! Calendar set aside by replaceHead().
+    CalendarQueue *savedCalendar;
+
     //! Mutex to protect async queue.
     std::mutex async_queue_mutex;
 
     //! List of events added by other threads to this event queue.
     std::list<Event*> async_queue;
 
+    //! Callbacks processed by the owning thread at quantum boundaries.
+    CallbackQueue quantumCallbacks;
+
     /**
      * Lock protecting event handling.
      *
@@ -526,6 +556,9 @@ class EventQueue
     void insert(Event *event);
     void remove(Event *event);
 
+    //! The top events of all bins in (when, priority) order.
+    std::vector<Event *> bins() const;
+
     //! Function for adding events to the async queue. The added events
     //! are added to main event queue later. Threads, other than the
     //! owning thread, should call this function instead of insert().
@@ -655,8 +688,22 @@ class EventQueue
     bool debugVerify() const;
 
     //! Function for moving events from the async_queue to the main queue.
+    //! Also processes the quantum callbacks.
     void handleAsyncInsertions();
 
+    /**
+     * Register a callback that the thread owning this queue processes
+     * every time it synchronizes with the other queues, i.e. at the
+     * start of the simulation loop and at every quantum boundary,
+     * after asynchronous insertions have been handled. Objects that
+     * exchange messages between queues without locking use this to
+     * pick up the messages sent during the previous quantum.
+     */
+    void addQuantumCallback(Callback *callback)
+    {
+        quantumCallbacks.add(callback);
+    }
+
     /**
      *  Function to signal that the event loop should be woken up because
      *  an event has been scheduled by an agent outside the gem5 event
@@ -711,7 +758,7 @@ class EventQueue
      */
     void checkpointReschedule(Event *event);
 
-    virtual ~EventQueue() { }
+    virtual ~EventQueue();
 };
 
 void dumpMainQueue();
@@ -809,7 +856,8 @@ class EventWrapper : public Event
     const char *description() const { return "EventWrapped"; }
 };
 
-class EventFunctionWrapper : public Event
+class EventFunctionWrapper : public Event,
+                             public EventPool<EventFunctionWrapper>
 {
   private:
       std::function<void(void)> callback;
@@ -837,4 +885,54 @@ class EventFunctionWrapper : public Event
     const char *description() const { return "EventFunctionWrapped"; }
 };
 
+/**
+ * An event that calls a function periodically. It reschedules itself
+ * after each call until it is stopped, so a periodic activity needs
+ * neither a new event per period nor rescheduling code in the
+ * callback.
+ */
+class PeriodicEvent : public Event
+{
+  private:
+    std::function<void(void)> callback;
+    std::string _name;
+    EventQueue *eventq;
+    Tick _period;
+    bool running;
+
+  public:
+    PeriodicEvent(const std::function<void(void)> &callback,
+                  const std::string &name,
+                  Priority p = Default_Pri)
+        : Event(p), callback(callback), _name(name), eventq(nullptr),
+          _period(0), running(false)
+    {}
+
+    /**
+     * Call the function at tick when and then every period ticks.
+     * Restarts the event if it is already running.
+     */
+    void start(EventQueue *q, Tick when, Tick period);
+
+    /** Stop calling the function, may be called from the callback. */
+    void stop();
+
+    bool isRunning() const { return running; }
+
+    Tick period() const { return _period; }
+
+    /** Change the period, takes effect after the next call. */
+    void period(Tick p) { _period = p; }
+
+    void process() override;
+
+    const std::string
+    name() const override
+    {
+        return _name + ".periodic_event";
+    }
+
+    const char *description() const override { return "PeriodicEvent"; }
+};
+
 #endif // __SIM_EVENTQ_HH__
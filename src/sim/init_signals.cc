@@ -58,6 +58,7 @@
 #include "base/atomicio.hh"
 #include "base/cprintf.hh"
 #include "base/logging.hh"
+#include "base/trace.hh"
 #include "sim/async.hh"
 #include "sim/backtrace.hh"
 #include "sim/core.hh"
@@ -136,12 +137,33 @@ dumprstStatsHandler(int sigtype)
 void
 exitNowHandler(int sigtype)
 {
+    // A second interrupt before the simulator got to exit, it may be
+    // stuck. Write the debug ring buffers and die.
+    if (async_exit) {
+        STATIC_ERR("Interrupted again, exiting now\n");
+        Trace::crashDump();
+        installSignalHandler(sigtype, SIG_DFL);
+        sigset_t mask;
+        sigemptyset(&mask);
+        sigaddset(&mask, sigtype);
+        pthread_sigmask(SIG_UNBLOCK, &mask, NULL);
+        raiseFatalSignal(sigtype);
+    }
+
     async_event = true;
     async_exit = true;
     /* Wake up some event queue to handle event */
     getEventQueue(0)->wakeup();
 }
 
+/// Termination signal handler.
+static void
+termHandler(int sigtype)
+{
+    Trace::crashDump();
+    raiseFatalSignal(sigtype);
+}
+
 /// Abort signal handler.
 void
 abortHandler(int sigtype)
@@ -154,6 +176,7 @@ abortHandler(int sigtype)
     }
 
     print_backtrace();
+    Trace::crashDump();
     raiseFatalSignal(sigtype);
 }
 
@@ -164,6 +187,7 @@ segvHandler(int sigtype)
     STATIC_ERR("gem5 has encountered a segmentation fault!\n\n");
 
     print_backtrace();
+    Trace::crashDump();
     raiseFatalSignal(SIGSEGV);
 }
 
@@ -194,9 +218,14 @@ initSignals()
     // Dump intermediate stats and reset them
     installSignalHandler(SIGUSR2, dumprstStatsHandler);
 
-    // Exit cleanly on Interrupt (Ctrl-C)
+    // Exit cleanly on Interrupt (Ctrl-C), or right away on a second
+    // one
     installSignalHandler(SIGINT, exitNowHandler);
 
+    // Write the debug ring buffers before being terminated. Reset the
+    // handler like for SIGABRT to invoke the default one afterwards.
+    installSignalHandler(SIGTERM, termHandler, SA_RESETHAND | SA_NODEFER);
+
     // Print the current cycle number and a backtrace on abort. Make
     // sure the signal is unmasked and the handler reset when a signal
     // is delivered to be able to invoke the default handler.
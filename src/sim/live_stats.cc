@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/live_stats.hh"
+
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "base/logging.hh"
+#include "base/statistics.hh"
+#include "cpu/base.hh"
+#include "sim/async.hh"
+#include "sim/eventq.hh"
+
+using namespace std;
+
+namespace Stats {
+
+namespace {
+
+/**
+ * Start of the shared memory segment. It is followed by the NUL
+ * terminated names of the values, padded to 8 bytes, and then by the
+ * values as doubles. The first value is always the host instruction
+ * rate since the previous update.
+ */
+struct LiveHeader
+{
+    char magic[8];
+    uint32_t version;
+    /** Number of values */
+    uint32_t count;
+    /** Size of the names following the header */
+    uint32_t namesSize;
+    uint32_t pid;
+    /** Sequence lock, odd while the values are being updated */
+    std::atomic<uint64_t> seq;
+    uint64_t updates;
+    uint64_t tick;
+    /** Host time of the start and of the last update, in Unix time */
+    double start;
+    double time;
+};
+
+const uint32_t liveVersion = 1;
+
+double
+unixTime()
+{
+    return chrono::duration<double>(
+        chrono::system_clock::now().time_since_epoch()).count();
+}
+
+class LiveStats
+{
+  private:
+    struct Entry
+    {
+        Info *info;
+        /** Element of a vector or formula, -1 for its total */
+        int index;
+    };
+
+    string name;
+    vector<Entry> entries;
+    /** Values of the next update, gathered before it starts */
+    vector<double> scratch;
+
+    char *segment;
+    size_t size;
+    LiveHeader *header;
+    double *values;
+
+    /** Instruction count and time of the last update */
+    Counter lastInsts;
+    double lastTime;
+
+    thread timer;
+    mutex timerMutex;
+    condition_variable timerCond;
+    bool stopping;
+
+    void resolve(const vector<string> &stats, vector<string> &names);
+    void run(double interval);
+
+  public:
+    LiveStats(const string &name, const vector<string> &stats,
+              double interval);
+    ~LiveStats();
+
+    void publish();
+};
+
+LiveStats::LiveStats(const string &_name, const vector<string> &stats,
+                     double interval)
+    : name(_name[0] == '/' ? _name : "/" + _name),
+      segment(nullptr), size(0), header(nullptr), values(nullptr),
+      lastInsts(0), lastTime(unixTime()), stopping(false)
+{
+    vector<string> names;
+    names.push_back("host_ips");
+    resolve(stats, names);
+
+    string blob;
+    for (const auto &n : names)
+        blob.append(n.c_str(), n.size() + 1);
+    blob.resize((blob.size() + 7) & ~(size_t)7, '\0');
+
+    size = sizeof(LiveHeader) + blob.size() + names.size() * sizeof(double);
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0)
+        fatal("Can't create shared memory segment %s: %s\n",
+              name, strerror(errno));
+    if (ftruncate(fd, size) != 0)
+        fatal("Can't size shared memory segment %s: %s\n",
+              name, strerror(errno));
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+        fatal("Can't map shared memory segment %s: %s\n",
+              name, strerror(errno));
+
+    segment = static_cast<char *>(ptr);
+    header = new (segment) LiveHeader();
+    header->version = liveVersion;
+    header->count = names.size();
+    header->namesSize = blob.size();
+    header->pid = getpid();
+    header->seq.store(0, memory_order_relaxed);
+    header->updates = 0;
+    header->tick = 0;
+    header->start = lastTime;
+    header->time = lastTime;
+    memcpy(segment + sizeof(LiveHeader), blob.data(), blob.size());
+    values = reinterpret_cast<double *>(
+        segment + sizeof(LiveHeader) + blob.size());
+    scratch.resize(names.size());
+
+    // Readers ignore the segment until the magic is in place
+    atomic_thread_fence(memory_order_release);
+    memcpy(header->magic, "gem5liv", 8);
+
+    inform("Publishing %d live stats in shared memory segment %s\n",
+           names.size(), name);
+
+    timer = thread(&LiveStats::run, this, interval);
+}
+
+LiveStats::~LiveStats()
+{
+    {
+        lock_guard<mutex> lock(timerMutex);
+        stopping = true;
+    }
+    timerCond.notify_all();
+    timer.join();
+
+    munmap(segment, size);
+    shm_unlink(name.c_str());
+}
+
+void
+LiveStats::resolve(const vector<string> &stats, vector<string> &names)
+{
+    const string &sep = Info::separatorString;
+    set<const Info *> seen;
+
+    for (const auto &pattern : stats) {
+        string base = pattern;
+        string sub;
+        size_t pos = pattern.find(sep);
+        if (pos != string::npos) {
+            base = pattern.substr(0, pos);
+            sub = pattern.substr(pos + sep.size());
+        }
+
+        bool matched = false;
+        for (auto info : statsList()) {
+            if (!info->flags.isSet(display) ||
+                fnmatch(base.c_str(), info->name.c_str(), 0) != 0) {
+                continue;
+            }
+            matched = true;
+
+            Entry entry = { info, -1 };
+            string entry_name = info->name;
+            if (auto vec = dynamic_cast<VectorInfo *>(info)) {
+                if (!sub.empty() && sub != "total") {
+                    for (size_type i = 0; i < vec->size(); ++i) {
+                        if (vec->subnames[i] == sub ||
+                            to_string(i) == sub) {
+                            entry.index = i;
+                        }
+                    }
+                    if (entry.index < 0)
+                        continue;
+                    entry_name += sep + sub;
+                }
+            } else if (!dynamic_cast<ScalarInfo *>(info) || !sub.empty()) {
+                warn("Live stats: %s is not a scalar, vector or formula, "
+                     "skipping it\n", info->name);
+                continue;
+            }
+
+            if (entry.index < 0 && !seen.insert(info).second)
+                continue;
+            entries.push_back(entry);
+            names.push_back(entry_name);
+        }
+
+        if (!matched)
+            warn("Live stats: no stat matches %s\n", pattern);
+    }
+}
+
+void
+LiveStats::run(double interval)
+{
+    const chrono::duration<double> period(interval);
+    unique_lock<mutex> lock(timerMutex);
+    while (!timerCond.wait_for(lock, period, [this] { return stopping; })) {
+        // Like the signal handlers, leave the work to the event loop
+        async_livestats = true;
+        async_event = true;
+        getEventQueue(0)->wakeup();
+    }
+}
+
+void
+LiveStats::publish()
+{
+    const double now = unixTime();
+    const Counter insts = BaseCPU::numSimulatedInsts();
+    scratch[0] = now > lastTime ? (insts - lastInsts) / (now - lastTime) : 0;
+    lastInsts = insts;
+    lastTime = now;
+
+    // Evaluate everything first to keep the update window short
+    for (size_t i = 0; i < entries.size(); ++i) {
+        Info *info = entries[i].info;
+        info->prepare();
+        if (auto vec = dynamic_cast<VectorInfo *>(info)) {
+            int index = entries[i].index;
+            scratch[i + 1] = index < 0 ?
+                vec->total() : vec->result()[index];
+        } else {
+            scratch[i + 1] = static_cast<ScalarInfo *>(info)->result();
+        }
+    }
+
+    const uint64_t seq = header->seq.load(memory_order_relaxed);
+    header->seq.store(seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    memcpy(values, scratch.data(), scratch.size() * sizeof(double));
+    header->updates++;
+    header->tick = curTick();
+    header->time = now;
+
+    header->seq.store(seq + 2, memory_order_release);
+}
+
+unique_ptr<LiveStats> liveStats;
+
+} // anonymous namespace
+
+void
+initLiveStats(const string &name, const vector<string> &stats,
+              double interval)
+{
+    fatal_if(liveStats, "Live stats are already being published\n");
+    fatal_if(interval <= 0, "The live stats interval must be positive\n");
+    liveStats.reset(new LiveStats(name, stats, interval));
+}
+
+void
+publishLiveStats()
+{
+    if (liveStats)
+        liveStats->publish();
+}
+
+} // namespace Stats
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_LIVE_STATS_HH__
+#define __SIM_LIVE_STATS_HH__
+
+#include <string>
+#include <vector>
+
+namespace Stats {
+
+/**
+ * Publish a set of statistics in a POSIX shared memory segment while
+ * the simulation runs, so that jobs can be monitored without parsing
+ * their stats files (see util/live_stats.py).
+ *
+ * A helper thread requests an update every interval of host time.
+ * The update itself happens in the simulation loop, between events,
+ * and only copies values. Readers use the sequence number in the
+ * segment header to retry instead of ever blocking the simulator.
+ *
+ * @param name Name of the segment, e.g. "gem5.job42".
+ * @param stats Stats to publish. Patterns are matched against the
+ *              stat names (fnmatch style). Vectors and formulas are
+ *              published as their total unless an element is selected
+ *              with "name::subname".
+ * @param interval Host seconds between updates.
+ */
+void initLiveStats(const std::string &name,
+                   const std::vector<std::string> &stats,
+                   double interval);
+
+/**
+ * Copy the current values to the shared memory segment. Called from
+ * the simulation loop when the update timer expired.
+ */
+void publishLiveStats();
+
+} // namespace Stats
+
+#endif // __SIM_LIVE_STATS_HH__
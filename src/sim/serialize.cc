@@ -50,11 +50,14 @@
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include <cerrno>
 #include <fstream>
 #include <list>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "arch/generic/vec_reg.hh"
@@ -169,6 +172,70 @@ int Serializable::ckptMaxCount = 0;
 int Serializable::ckptCount = 0;
 int Serializable::ckptPrevCount = -1;
 std::stack<std::string> Serializable::path;
+bool Serializable::binaryCheckpoints = false;
+
+/// Binary checkpoint being written, if any
+static IndexedIni::Writer *binaryWriter = nullptr;
+
+//
+// Binary checkpoints hold arrays of numbers as they are rather than as
+// text, bools as one byte each.
+//
+template <class T>
+struct BulkArray
+    : public std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                    sizeof(T) <= sizeof(uint64_t)>
+{};
+
+template <class T>
+using BulkElem =
+    typename std::conditional<std::is_same<T, bool>::value, uint8_t, T>::type;
+
+template <class T, class Iter>
+typename std::enable_if<BulkArray<T>::value, bool>::type
+bulkArrayOut(const string &name, Iter begin, Iter end)
+{
+    if (!binaryWriter)
+        return false;
+
+    vector<BulkElem<T>> values(begin, end);
+    binaryWriter->addArray(Serializable::currentSection(), name,
+                           IndexedIni::arrayType<T>(), values.data(),
+                           values.size());
+    return true;
+}
+
+template <class T, class Iter>
+typename std::enable_if<!BulkArray<T>::value, bool>::type
+bulkArrayOut(const string &name, Iter begin, Iter end)
+{
+    return false;
+}
+
+template <class T>
+typename std::enable_if<BulkArray<T>::value, bool>::type
+bulkArrayIn(CheckpointIn &cp, const string &name,
+            const BulkElem<T> *&values, size_t &count)
+{
+    IndexedIni::Type type;
+    const void *data;
+    if (!cp.findArray(Serializable::currentSection(), name, type, data,
+                      count) ||
+        type != IndexedIni::arrayType<T>()) {
+        return false;
+    }
+
+    values = static_cast<const BulkElem<T> *>(data);
+    return true;
+}
+
+template <class T>
+typename std::enable_if<!BulkArray<T>::value, bool>::type
+bulkArrayIn(CheckpointIn &cp, const string &name,
+            const BulkElem<T> *&values, size_t &count)
+{
+    return false;
+}
 
 template <class T>
 void
@@ -183,6 +250,9 @@ template <class T>
 void
 arrayParamOut(CheckpointOut &os, const string &name, const vector<T> &param)
 {
+    if (bulkArrayOut<T>(name, param.begin(), param.end()))
+        return;
+
     typename vector<T>::size_type size = param.size();
     os << name << "=";
     if (size > 0)
@@ -198,6 +268,9 @@ template <class T>
 void
 arrayParamOut(CheckpointOut &os, const string &name, const list<T> &param)
 {
+    if (bulkArrayOut<T>(name, param.begin(), param.end()))
+        return;
+
     typename list<T>::const_iterator it = param.begin();
 
     os << name << "=";
@@ -261,6 +334,9 @@ void
 arrayParamOut(CheckpointOut &os, const string &name,
               const T *param, unsigned size)
 {
+    if (bulkArrayOut<T>(name, param, param + size))
+        return;
+
     os << name << "=";
     if (size > 0)
         showParam(os, param[0]);
@@ -277,6 +353,15 @@ void
 arrayParamIn(CheckpointIn &cp, const string &name, T *param, unsigned size)
 {
     const string &section(Serializable::currentSection());
+    const BulkElem<T> *values;
+    size_t count;
+    if (bulkArrayIn<T>(cp, name, values, count)) {
+        if (count != size)
+            fatal("Array size mismatch on %s:%s'\n", section, name);
+        std::copy(values, values + count, param);
+        return;
+    }
+
     string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
@@ -321,6 +406,13 @@ void
 arrayParamIn(CheckpointIn &cp, const string &name, vector<T> &param)
 {
     const string &section(Serializable::currentSection());
+    const BulkElem<T> *values;
+    size_t count;
+    if (bulkArrayIn<T>(cp, name, values, count)) {
+        param.assign(values, values + count);
+        return;
+    }
+
     string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
@@ -363,6 +455,13 @@ void
 arrayParamIn(CheckpointIn &cp, const string &name, list<T> &param)
 {
     const string &section(Serializable::currentSection());
+    const BulkElem<T> *values;
+    size_t count;
+    if (bulkArrayIn<T>(cp, name, values, count)) {
+        param.assign(values, values + count);
+        return;
+    }
+
     string str;
     if (!cp.find(section, name, str)) {
         fatal("Can't unserialize '%s:%s'\n", section, name);
@@ -598,6 +697,28 @@ Serializable::serializeAll(const string &cpt_dir)
     if (mkdir(dir.c_str(), 0775) == -1 && errno != EEXIST)
             fatal("couldn't mkdir %s\n", dir);
 
+    // Restoring prefers the binary file, don't leave one of an older
+    // checkpoint of the other format around
+    unlink((dir + (binaryCheckpoints ? CheckpointIn::baseFilename :
+                   CheckpointIn::binaryFilename)).c_str());
+
+    if (binaryCheckpoints) {
+        // Scalars still go through the text stream, arrays of numbers
+        // go to the writer directly
+        string cpt_file = dir + CheckpointIn::binaryFilename;
+        IndexedIni::Writer writer;
+        stringstream text;
+
+        binaryWriter = &writer;
+        globals.serializeSection(text, "Globals");
+        SimObject::serializeAll(text);
+        binaryWriter = nullptr;
+
+        if (!writer.load(text) || !writer.write(cpt_file))
+            fatal("Unable to write checkpoint file %s\n", cpt_file);
+        return;
+    }
+
     string cpt_file = dir + CheckpointIn::baseFilename;
     ofstream outstream(cpt_file.c_str());
     time_t t = time(NULL);
@@ -660,6 +781,7 @@ Serializable::currentSection()
 }
 
 const char *CheckpointIn::baseFilename = "m5.cpt";
+const char *CheckpointIn::binaryFilename = "m5.cpb";
 
 string CheckpointIn::currentDirectory;
 
@@ -683,9 +805,20 @@ CheckpointIn::dir()
 
 
 CheckpointIn::CheckpointIn(const string &cpt_dir, SimObjectResolver &resolver)
-    : db(new IniFile), objNameResolver(resolver), cptDir(setDir(cpt_dir))
-{
-    string filename = cptDir + "/" + CheckpointIn::baseFilename;
+    : db(nullptr), indexed(nullptr), objNameResolver(resolver),
+      cptDir(setDir(cpt_dir))
+{
+    // Sections of binary checkpoints are only read when looked up
+    string filename = cptDir + "/" + CheckpointIn::binaryFilename;
+    if (access(filename.c_str(), F_OK) == 0) {
+        indexed = new IndexedIni::File;
+        if (!indexed->load(filename))
+            fatal("Can't load checkpoint file '%s'\n", filename);
+        return;
+    }
+
+    db = new IniFile;
+    filename = cptDir + "/" + CheckpointIn::baseFilename;
     if (!db->load(filename)) {
         fatal("Can't load checkpoint file '%s'\n", filename);
     }
@@ -694,20 +827,33 @@ CheckpointIn::CheckpointIn(const string &cpt_dir, SimObjectResolver &resolver)
 CheckpointIn::~CheckpointIn()
 {
     delete db;
+    delete indexed;
 }
 
 bool
 CheckpointIn::entryExists(const string &section, const string &entry)
 {
+    if (indexed)
+        return indexed->entryExists(section, entry);
     return db->entryExists(section, entry);
 }
 
 bool
 CheckpointIn::find(const string &section, const string &entry, string &value)
 {
+    if (indexed)
+        return indexed->find(section, entry, value);
     return db->find(section, entry, value);
 }
 
+bool
+CheckpointIn::findArray(const string &section, const string &entry,
+                        IndexedIni::Type &type, const void *&data,
+                        size_t &count)
+{
+    return indexed && indexed->findArray(section, entry, type, data, count);
+}
+
 
 bool
 CheckpointIn::findObj(const string &section, const string &entry,
@@ -715,7 +861,7 @@ CheckpointIn::findObj(const string &section, const string &entry,
 {
     string path;
 
-    if (!db->find(section, entry, path))
+    if (!find(section, entry, path))
         return false;
 
     value = objNameResolver.resolveSimObject(path);
@@ -726,5 +872,7 @@ CheckpointIn::findObj(const string &section, const string &entry,
 bool
 CheckpointIn::sectionExists(const string &section)
 {
+    if (indexed)
+        return indexed->sectionExists(section);
     return db->sectionExists(section);
 }
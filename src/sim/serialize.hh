@@ -60,6 +60,7 @@
 #include <vector>
 
 #include "base/bitunion.hh"
+#include "base/indexed_ini.hh"
 
 class CheckpointIn;
 class IniFile;
@@ -364,6 +365,12 @@ class Serializable
     static void serializeAll(const std::string &cpt_dir);
     static void unserializeGlobals(CheckpointIn &cp);
 
+    /**
+     * Write the checkpoint metadata as an indexed binary file instead
+     * of an ini file, see IndexedIni. Restoring works with either.
+     */
+    static bool binaryCheckpoints;
+
   private:
     static std::stack<std::string> path;
 };
@@ -376,6 +383,8 @@ class CheckpointIn
   private:
 
     IniFile *db;
+    /** The metadata of a binary checkpoint, db is null then */
+    IndexedIni::File *indexed;
 
     SimObjectResolver &objNameResolver;
 
@@ -391,6 +400,13 @@ class CheckpointIn
     bool findObj(const std::string &section, const std::string &entry,
                  SimObject *&value);
 
+    /**
+     * Find an array that a binary checkpoint holds as is. False for
+     * all other entries, which find() returns as text.
+     */
+    bool findArray(const std::string &section, const std::string &entry,
+                   IndexedIni::Type &type, const void *&data, size_t &count);
+
 
     bool entryExists(const std::string &section, const std::string &entry);
     bool sectionExists(const std::string &section);
@@ -420,6 +436,8 @@ class CheckpointIn
 
     // Filename for base checkpoint file within directory.
     static const char *baseFilename;
+    // Filename for the base checkpoint file of binary checkpoints.
+    static const char *binaryFilename;
 };
 
 #endif // __SERIALIZE_HH__
@@ -34,13 +34,16 @@
 #include "sim/simulate.hh"
 
 #include <mutex>
+#include <new>
 #include <thread>
 
 #include "base/logging.hh"
 #include "base/pollevent.hh"
+#include "base/trace.hh"
 #include "base/types.hh"
 #include "sim/async.hh"
 #include "sim/eventq_impl.hh"
+#include "sim/live_stats.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
 #include "sim/stat_control.hh"
@@ -74,6 +77,49 @@ thread_loop(EventQueue *queue)
 
 GlobalSimLoopExitEvent *simulate_limit_event = nullptr;
 
+//! The subordinate threads, once the simulation has started
+static std::vector<std::thread *> threads;
+
+static void
+spawnThreads()
+{
+    // the main thread (the one we're currently running on)
+    // handles queue 0, so we only need to allocate new threads
+    // for queues 1..N-1.  We'll call these the "subordinate" threads.
+    for (uint32_t i = 1; i < numMainEventQueues; i++) {
+        threads.push_back(new std::thread(thread_loop, mainEventQueue[i]));
+    }
+}
+
+static void
+startThreads()
+{
+    threadBarrier = new Barrier(numMainEventQueues);
+    spawnThreads();
+}
+
+void
+restartSimThreads()
+{
+    if (threads.empty())
+        return;
+
+    // Only the forking thread lives on in the child. The thread
+    // objects of the others can be detached and freed, but not
+    // joined.
+    for (auto thread : threads) {
+        thread->detach();
+        delete thread;
+    }
+    threads.clear();
+
+    // The old threads were all waiting on the barrier, and its
+    // condition variable still counts them, so destroying it would
+    // wait for them forever. Build a new barrier in its place instead.
+    new (threadBarrier) Barrier(numMainEventQueues);
+    spawnThreads();
+}
+
 /** Simulate for num_cycles additional cycles.  If num_cycles is -1
  * (the default), do not limit simulation; some other event must
  * terminate the loop.  Exported to Python.
@@ -86,17 +132,9 @@ simulate(Tick num_cycles)
     // create a thread for each of event queues referenced by the
     // instantiated sim objects.
     static bool threads_initialized = false;
-    static std::vector<std::thread *> threads;
 
     if (!threads_initialized) {
-        threadBarrier = new Barrier(numMainEventQueues);
-
-        // the main thread (the one we're currently running on)
-        // handles queue 0, so we only need to allocate new threads
-        // for queues 1..N-1.  We'll call these the "subordinate" threads.
-        for (uint32_t i = 1; i < numMainEventQueues; i++) {
-            threads.push_back(new std::thread(thread_loop, mainEventQueue[i]));
-        }
+        startThreads();
 
         threads_initialized = true;
         simulate_limit_event =
@@ -205,8 +243,15 @@ doSimLoop(EventQueue *eventq)
                 pollQueue.service();
             }
 
+            if (async_livestats) {
+                async_livestats = false;
+                Stats::publishLiveStats();
+            }
+
             if (async_exit) {
                 async_exit = false;
+                // Keep the last debug messages before the interrupt
+                Trace::crashDump();
                 exitSimLoop("user interrupt received");
             }
 
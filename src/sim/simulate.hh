@@ -34,4 +34,11 @@
 class GlobalSimLoopExitEvent;
 
 GlobalSimLoopExitEvent *simulate(Tick num_cycles = MaxTick);
+
+/**
+ * Recreate the threads simulating the event queues other than the
+ * first one in the child of a fork, which only inherits the thread
+ * that called fork().
+ */
+void restartSimThreads();
 extern GlobalSimLoopExitEvent *simulate_limit_event;
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Event queue microbenchmark: a population of clocked objects with
+ * different periods and phases that reschedule themselves every cycle,
+ * plus a stream of one-shot events with a long tail of latencies, run
+ * on both the list and the calendar event queue. Before timing, a
+ * random trace of schedules, reschedules and deschedules is run on
+ * both queues to check that they service events in the same order.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "sim/eventq_impl.hh"
+
+using namespace std;
+
+class ClockedEvent : public Event
+{
+  private:
+    EventQueue &queue;
+    Tick period;
+
+  public:
+    ClockedEvent(EventQueue &q, Tick p, Priority prio)
+        : Event(prio), queue(q), period(p)
+    {}
+
+    void process() { queue.schedule(this, when() + period); }
+};
+
+class OneShotEvent : public Event
+{
+  private:
+    EventQueue &queue;
+    mt19937 &rng;
+
+  public:
+    OneShotEvent(EventQueue &q, mt19937 &r)
+        : queue(q), rng(r)
+    {}
+
+    void
+    process()
+    {
+        // Mostly short cache-like latencies with occasional long ones.
+        Tick delay = (rng() % 16 == 0) ? 1000 * (rng() % 1000) :
+            500 * (1 + rng() % 40);
+        queue.schedule(this, when() + delay);
+    }
+};
+
+class TraceEvent : public Event
+{
+  private:
+    vector<int> &serviced;
+    int id;
+
+  public:
+    TraceEvent(vector<int> &s, int i, Priority prio)
+        : Event(prio), serviced(s), id(i)
+    {}
+
+    void process() { serviced.push_back(id); }
+};
+
+vector<int>
+runTrace(bool calendar, unsigned seed)
+{
+    useCalendarEventQueue = calendar;
+    EventQueue queue(calendar ? "calendar" : "list");
+    curEventQueue(&queue);
+
+    mt19937 rng(seed);
+    vector<int> serviced;
+    vector<TraceEvent *> events;
+    for (int i = 0; i < 20000; ++i) {
+        events.push_back(new TraceEvent(serviced, i,
+                                        Event::Default_Pri + rng() % 3 - 1));
+    }
+
+    Tick now = 0;
+    for (int step = 0; step < 200000; ++step) {
+        unsigned action = rng() % 10;
+        TraceEvent *event = events[rng() % events.size()];
+        if (action < 5) {
+            // Many events on the same few ticks, some far in the future
+            Tick when = now + (rng() % 4 == 0 ? rng() % 1000000 :
+                               (rng() % 8) * 500);
+            if (event->scheduled())
+                queue.reschedule(event, when);
+            else
+                queue.schedule(event, when);
+        } else if (action < 6) {
+            if (event->scheduled())
+                queue.deschedule(event);
+        } else if (!queue.empty()) {
+            now = queue.nextTick();
+            queue.serviceOne();
+        }
+    }
+    while (!queue.empty())
+        queue.serviceOne();
+
+    for (auto event : events)
+        delete event;
+
+    return serviced;
+}
+
+bool
+checkOrdering(unsigned seed)
+{
+    vector<int> list = runTrace(false, seed);
+    vector<int> calendar = runTrace(true, seed);
+    bool match = list == calendar;
+
+    cprintf("ordering seed %d: %d events serviced, %s\n", seed,
+            list.size(), match ? "same order" : "ORDER DIFFERS");
+
+    return match;
+}
+
+double
+runBenchmark(bool calendar, int num_clocked, int num_oneshot, Tick ticks)
+{
+    useCalendarEventQueue = calendar;
+    EventQueue queue(calendar ? "calendar" : "list");
+    curEventQueue(&queue);
+
+    mt19937 rng(1);
+    vector<Event *> events;
+    const Tick periods[] = { 250, 333, 500, 1000 };
+    for (int i = 0; i < num_clocked; ++i) {
+        Tick period = periods[i % 4];
+        Event *event = new ClockedEvent(queue, period,
+                                        Event::Default_Pri + i % 3);
+        queue.schedule(event, rng() % period);
+        events.push_back(event);
+    }
+
+    for (int i = 0; i < num_oneshot; ++i) {
+        Event *event = new OneShotEvent(queue, rng);
+        queue.schedule(event, rng() % 100000);
+        events.push_back(event);
+    }
+
+    auto start = chrono::steady_clock::now();
+    uint64_t serviced = 0;
+    while (!queue.empty() && queue.nextTick() < ticks) {
+        queue.serviceOne();
+        ++serviced;
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    for (auto event : events) {
+        if (event->scheduled())
+            queue.deschedule(event);
+        delete event;
+    }
+
+    cprintf("%-8s %6d clocked %6d one-shot: %10d events in %7.3fs, "
+            "%6.2f Mevents/s\n", queue.name(), num_clocked, num_oneshot,
+            serviced, elapsed.count(), serviced / elapsed.count() / 1e6);
+
+    return elapsed.count();
+}
+
+int
+main(int argc, char *argv[])
+{
+    Tick ticks = argc > 1 ? strtoull(argv[1], NULL, 0) : 2000000;
+
+    bool match = true;
+    for (unsigned seed = 1; seed <= 3; ++seed)
+        match = checkOrdering(seed) && match;
+    if (!match)
+        return 1;
+
+    for (int objects : { 16, 256, 1024 }) {
+        double list = runBenchmark(false, objects, objects, ticks);
+        double calendar = runBenchmark(true, objects, objects, ticks);
+        cprintf("speedup %.2fx\n", list / calendar);
+    }
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 The TyCHE Project
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Hash map microbenchmark: FlatHashMap against std::unordered_map on
+ * access patterns modelled on the maps it replaced.
+ *
+ * - snoop filter: line-aligned addresses from 16 cores with a shared
+ *   region, looked up on every request, inserted on a miss and erased
+ *   on eviction once the filter is full.
+ * - routing table: shared pointer keys inserted when a request is
+ *   forwarded and erased when its response returns, with a few
+ *   hundred requests outstanding.
+ * - tag index: lookups in a fixed set of resident lines with
+ *   occasional replacements, as in a Ruby cache.
+ *
+ * Both maps are run on the same operation stream and must agree on
+ * the number of hits.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/flat_hash_map.hh"
+#include "base/types.hh"
+
+using namespace std;
+
+struct SnoopItem
+{
+    uint64_t requested;
+    uint64_t holder;
+};
+
+struct FakeRequest
+{
+    Addr addr;
+};
+
+typedef shared_ptr<FakeRequest> FakeRequestPtr;
+
+const int NumCores = 16;
+const Addr LineSize = 64;
+
+struct Result
+{
+    uint64_t ops;
+    uint64_t hits;
+    double seconds;
+};
+
+template <typename Map>
+Result
+snoopFilter(uint64_t ops)
+{
+    const size_t capacity = NumCores * 8192;
+    mt19937_64 rng(1);
+    Map map;
+    vector<Addr> resident;
+    resident.reserve(capacity);
+    uint64_t hits = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (uint64_t i = 0; i < ops; ++i) {
+        int core = rng() % NumCores;
+        // A quarter of the accesses go to a region shared by all cores,
+        // the rest to a private working set twice the filter's reach.
+        Addr line = rng() % (capacity / NumCores * 2);
+        Addr addr = (rng() % 4 == 0) ? (Addr(1) << 40) + line * LineSize :
+            (Addr(core) << 32) + line * LineSize;
+
+        auto it = map.find(addr);
+        if (it != map.end()) {
+            ++hits;
+            it->second.holder |= uint64_t(1) << core;
+            continue;
+        }
+
+        if (resident.size() == capacity) {
+            size_t victim = rng() % resident.size();
+            map.erase(resident[victim]);
+            resident[victim] = resident.back();
+            resident.pop_back();
+        }
+        SnoopItem item = { 0, uint64_t(1) << core };
+        map.emplace(addr, item);
+        resident.push_back(addr);
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    return Result{ ops, hits, elapsed.count() };
+}
+
+template <typename Map>
+Result
+routingTable(uint64_t ops)
+{
+    const size_t outstanding = 512;
+    mt19937_64 rng(2);
+    Map map;
+    vector<FakeRequestPtr> inflight;
+    inflight.reserve(outstanding);
+    uint64_t hits = 0;
+
+    // Allocate requests up front so that the timed loop is dominated
+    // by the map rather than by the heap.
+    vector<FakeRequestPtr> requests;
+    for (size_t i = 0; i < outstanding * 4; ++i)
+        requests.push_back(make_shared<FakeRequest>(FakeRequest{ i }));
+
+    auto start = chrono::steady_clock::now();
+    for (uint64_t i = 0; i < ops; ++i) {
+        if (inflight.size() < outstanding && (inflight.empty() ||
+                                              rng() % 2 == 0)) {
+            // Forward a request, unless it is still in flight
+            const FakeRequestPtr &req = requests[rng() % requests.size()];
+            if (map.emplace(req, rng() % NumCores).second)
+                inflight.push_back(req);
+        } else {
+            // Route a response back and forget the request
+            size_t idx = rng() % inflight.size();
+            auto it = map.find(inflight[idx]);
+            if (it != map.end()) {
+                hits += it->second;
+                map.erase(it);
+            }
+            inflight[idx] = inflight.back();
+            inflight.pop_back();
+        }
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    return Result{ ops, hits, elapsed.count() };
+}
+
+template <typename Map>
+Result
+tagIndex(uint64_t ops)
+{
+    const size_t lines = 32768;
+    mt19937_64 rng(3);
+    Map map;
+    vector<Addr> resident;
+    for (size_t i = 0; i < lines; ++i) {
+        Addr addr = (rng() % (lines * 16)) * LineSize;
+        if (map.emplace(addr, int(i)).second)
+            resident.push_back(addr);
+    }
+    uint64_t hits = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (uint64_t i = 0; i < ops; ++i) {
+        Addr addr = (rng() % (lines * 2)) * LineSize;
+        auto it = map.find(addr);
+        if (it != map.end()) {
+            hits += it->second != -1;
+        } else if (rng() % 8 == 0) {
+            // Replace a line on some of the misses
+            size_t victim = rng() % resident.size();
+            auto victim_it = map.find(resident[victim]);
+            int way = victim_it->second;
+            map.erase(victim_it);
+            map.emplace(addr, way);
+            resident[victim] = addr;
+        }
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    return Result{ ops, hits, elapsed.count() };
+}
+
+bool
+report(const char *name, const Result &flat, const Result &std_map)
+{
+    cprintf("%-14s unordered_map %7.2f Mops/s, FlatHashMap %7.2f Mops/s, "
+            "speedup %.2fx\n", name, std_map.ops / std_map.seconds / 1e6,
+            flat.ops / flat.seconds / 1e6, std_map.seconds / flat.seconds);
+
+    if (flat.hits != std_map.hits) {
+        cprintf("%s: hit counts differ, %d vs %d\n", name, flat.hits,
+                std_map.hits);
+        return false;
+    }
+    return true;
+}
+
+int
+main(int argc, char *argv[])
+{
+    uint64_t ops = argc > 1 ? strtoull(argv[1], NULL, 0) : 10000000;
+
+    bool match = true;
+
+    match = report("snoop filter",
+                   snoopFilter<FlatHashMap<Addr, SnoopItem>>(ops),
+                   snoopFilter<unordered_map<Addr, SnoopItem>>(ops)) &&
+        match;
+    match = report("routing table",
+                   routingTable<FlatHashMap<FakeRequestPtr, int>>(ops),
+                   routingTable<unordered_map<FakeRequestPtr, int>>(ops)) &&
+        match;
+    match = report("tag index",
+                   tagIndex<FlatHashMap<Addr, int>>(ops),
+                   tagIndex<unordered_map<Addr, int>>(ops)) && match;
+
+    return match ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+'''
+Checks that skipping quiescent O3 cycles does not change any statistic: the
+same workload is run with and without idleSkip and the stats are compared.
+'''
+import re
+import os
+
+from testlib import *
+from testlib.config import constants
+from testlib.helper import log_call, diff_out_file
+
+test_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                 'hello64-static')
+
+se_config = joinpath(config.base_dir, 'configs', 'example', 'se.py')
+se_args = ['--cpu-type', 'DerivO3CPU', '--caches', '--l2cache',
+           '--cmd', test_program.path]
+
+# Host stats and the stats that count the skipping itself differ by design.
+ignore_regex = (
+    re.compile('^host_'),
+    re.compile(r'^\S+\.(skippedCycles|timesSkipped)\s'),
+)
+
+class MatchStatsWithoutIdleSkip(verifier.Verifier):
+    '''
+    Runs the workload again without idleSkip and diffs both stats.txt.
+    '''
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        gem5 = fixtures[constants.gem5_binary_fixture_name].path
+        refdir = joinpath(tempdir, 'no-idle-skip')
+
+        log_call(params.log, [gem5, '-d', refdir, '-re', se_config] + se_args)
+
+        diff = diff_out_file(joinpath(refdir, constants.gem5_simulation_stats),
+                             joinpath(tempdir,
+                                      constants.gem5_simulation_stats),
+                             ignore_regexes=ignore_regex,
+                             logger=params.log)
+        if diff is not None:
+            self.failed(fixtures)
+            test.fail('Idle skip changed the stats:\n%s\nSee %s for full '
+                      'results' % (diff, tempdir))
+
+gem5_verify_config(
+    name='o3_idle_skip_stats',
+    verifiers=(MatchStatsWithoutIdleSkip(),),
+    fixtures=(test_program,),
+    config=se_config,
+    config_args=se_args + ['--param', 'system.cpu[0].idleSkip = True'],
+    valid_isas=('X86',),
+)
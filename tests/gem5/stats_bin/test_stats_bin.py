@@ -0,0 +1,83 @@
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+'''
+Checks that a binary stats file converts back to the text stats: a
+program is run with periodic dumps written both ways, and the file
+converted by util/stats_bin.py is compared with stats.txt.
+'''
+import re
+import os
+import sys
+
+from testlib import *
+from testlib.config import constants
+from testlib.helper import log_call, diff_out_file
+
+test_program = DownloadedProgram(os.path.join('hello', 'bin', 'x86', 'linux'),
+                                 'hello64-static')
+
+stats_config = joinpath(os.path.dirname(os.path.abspath(__file__)),
+                        'binary_stats.py')
+stats_bin = joinpath(config.base_dir, 'util', 'stats_bin.py')
+
+# Host stats are computed again for each output
+ignore_regex = (
+    re.compile('^host_'),
+)
+
+class MatchConvertedStats(verifier.Verifier):
+    '''
+    Converts stats.bin to text and diffs it with stats.txt.
+    '''
+    def test(self, params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        converted = joinpath(tempdir, 'stats_bin.txt')
+
+        log_call(params.log, [sys.executable, stats_bin,
+                              joinpath(tempdir, 'stats.bin'),
+                              '-o', converted])
+
+        diff = diff_out_file(joinpath(tempdir,
+                                      constants.gem5_simulation_stats),
+                             converted,
+                             ignore_regexes=ignore_regex,
+                             logger=params.log)
+        if diff is not None:
+            self.failed(fixtures)
+            test.fail('The binary stats differ from the text ones:\n%s\n'
+                      'See %s for full results' % (diff, tempdir))
+
+gem5_verify_config(
+    name='stats_bin_round_trip',
+    verifiers=(MatchConvertedStats(),),
+    fixtures=(test_program,),
+    config=stats_config,
+    config_args=[test_program.path, '--period', '10us'],
+    valid_isas=('X86',),
+)
@@ -0,0 +1,161 @@
+#!/usr/bin/env python2
+#
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Reader for the indexed checkpoint files (m5.cpb) written by
+# IndexedIni::Writer, see src/base/indexed_ini.hh. As a module it
+# loads a file into a list of sections:
+#
+#   import cpb2cpt
+#   for section, entries in cpb2cpt.read("cpt.1000/m5.cpb"):
+#       ...
+#
+# As a script it converts a file to the text format of m5.cpt:
+#
+#   cpb2cpt.py cpt.1000/m5.cpb -o cpt.1000/m5.cpt
+
+from __future__ import print_function
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"gem5cpb\0"
+VERSION = 1
+
+# Entry types and the struct format of their elements, see
+# IndexedIni::Type
+TEXT, BOOL, FLOAT, DOUBLE = 0, 9, 10, 11
+ELEMENTS = {
+    1: "b", 2: "B", 3: "h", 4: "H", 5: "i", 6: "I", 7: "q", 8: "Q",
+    BOOL: "B", FLOAT: "f", DOUBLE: "d",
+}
+
+HEADER = struct.Struct("=8sIIIIQ")
+SLOT = struct.Struct("=QQ")
+SECTION = struct.Struct("=II")
+ENTRY = struct.Struct("=QQIIII")
+
+def _align(offset):
+    return (offset + 7) & ~7
+
+def _text(data):
+    return data.decode("utf-8")
+
+def _value(data, kind, count, offset):
+    """The value of an entry as the text an ini file would hold"""
+
+    if kind == TEXT:
+        return _text(data[offset:offset + count])
+
+    if kind not in ELEMENTS:
+        raise ValueError("unknown entry type %d" % kind)
+    fmt = "=%d%s" % (count, ELEMENTS[kind])
+    values = struct.unpack_from(fmt, data, offset)
+    if kind == BOOL:
+        return " ".join("true" if v else "false" for v in values)
+    if kind in (FLOAT, DOUBLE):
+        return " ".join(repr(v) for v in values)
+    return " ".join(str(v) for v in values)
+
+def read(path):
+    """Load a file as a list of (section, [(entry, value)]) in the
+    order the sections were written, with the entries sorted"""
+
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER.size:
+        raise ValueError("%s: not an indexed checkpoint" % path)
+    magic, version, order, num_sections, table_size, table_offset = \
+        HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("%s: not an indexed checkpoint" % path)
+    if order != 0x01020304:
+        raise ValueError("%s: written with a different byte order" % path)
+    if version != VERSION:
+        raise ValueError("%s: unsupported version %d" % (path, version))
+
+    offsets = []
+    for i in range(table_size):
+        slot_hash, offset = SLOT.unpack_from(data,
+                                             table_offset + i * SLOT.size)
+        if offset:
+            offsets.append(offset)
+
+    sections = []
+    for offset in sorted(offsets):
+        name_size, num_entries = SECTION.unpack_from(data, offset)
+        name_offset = offset + SECTION.size
+        name = _text(data[name_offset:name_offset + name_size])
+
+        entries = []
+        records = _align(name_offset + name_size)
+        for i in range(num_entries):
+            name_offset, data_offset, name_size, count, kind, reserved = \
+                ENTRY.unpack_from(data, records + i * ENTRY.size)
+            entries.append((_text(data[name_offset:name_offset + name_size]),
+                            _value(data, kind, count, data_offset)))
+        sections.append((name, entries))
+
+    if len(sections) != num_sections:
+        raise ValueError("%s: corrupt section table" % path)
+    return sections
+
+def write_ini(sections, out):
+    """Write sections in the format of m5.cpt"""
+
+    for name, entries in sections:
+        out.write("[%s]\n" % name)
+        for entry, value in entries:
+            out.write("%s=%s\n" % (entry, value))
+        out.write("\n")
+
+def convert(cpb_path, cpt_path):
+    """Convert m5.cpb to m5.cpt"""
+
+    sections = read(cpb_path)
+    with open(cpt_path, "w") as out:
+        write_ini(sections, out)
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert an indexed checkpoint file to text")
+    parser.add_argument("input", help="indexed checkpoint file (m5.cpb)")
+    parser.add_argument("-o", "--output", default="-",
+                        help="output file [Default: stdout]")
+    args = parser.parse_args()
+
+    sections = read(args.input)
+    if args.output == "-":
+        write_ini(sections, sys.stdout)
+    else:
+        with open(args.output, "w") as out:
+            write_ini(sections, out)
+
+if __name__ == "__main__":
+    main()
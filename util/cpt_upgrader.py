@@ -55,7 +55,9 @@
 # the checkpoint tag list, the upgrade() method will be run, passing in a
 # ConfigParser object which contains the open file. As these operations can
 # be isa specific the method can verify the isa and use regexes to find the
-# correct sections that need to be updated.
+# correct sections that need to be updated. Indexed checkpoints (m5.cpb)
+# are read with util/cpb2cpt.py and written back as text (m5.cpt) when they
+# need an upgrade.
 
 # It is also possible to use this mechanism to revert prior tags.  In this
 # case, implement a downgrade() method instead.  Dependencies should still
@@ -191,7 +193,10 @@ def process_file(path, **kwargs):
 
     verboseprint("Processing file %s...." % path)
 
-    if kwargs.get('backup', True):
+    # Indexed checkpoints (m5.cpb) are upgraded to text ones
+    binary = osp.basename(path) == 'm5.cpb'
+
+    if kwargs.get('backup', True) and not binary:
         import shutil
         shutil.copyfile(path, path + '.bak')
 
@@ -201,7 +206,14 @@ def process_file(path, **kwargs):
     cpt.optionxform = str
 
     # Read the current data
-    cpt_file = file(path, 'r')
+    if binary:
+        import cpb2cpt
+        from StringIO import StringIO
+        cpt_file = StringIO()
+        cpb2cpt.write_ini(cpb2cpt.read(path), cpt_file)
+        cpt_file.seek(0)
+    else:
+        cpt_file = file(path, 'r')
     cpt.readfp(cpt_file)
     cpt_file.close()
 
@@ -259,7 +271,16 @@ def process_file(path, **kwargs):
 
     # Write the old data back
     verboseprint("...completed")
-    cpt.write(file(path, 'w'))
+    if binary:
+        # gem5 reads m5.cpb rather than m5.cpt when both exist, so move
+        # it out of the way of the upgraded file
+        cpt.write(file(osp.join(osp.dirname(path), 'm5.cpt'), 'w'))
+        if kwargs.get('backup', True):
+            os.rename(path, path + '.bak')
+        else:
+            os.remove(path)
+    else:
+        cpt.write(file(path, 'w'))
 
 if __name__ == '__main__':
     from optparse import OptionParser, SUPPRESS_HELP
@@ -303,15 +324,17 @@ if __name__ == '__main__':
         process_file(path, **vars(options))
     # Process an entire directory
     elif osp.isdir(path):
-        cpt_file = osp.join(path, 'm5.cpt')
+        # gem5 reads m5.cpb rather than m5.cpt when both exist
+        cpt_file = osp.join(path, 'm5.cpb')
+        if not osp.isfile(cpt_file):
+            cpt_file = osp.join(path, 'm5.cpt')
         if options.recurse:
             # Visit very file and see if it matches
             for root,dirs,files in os.walk(path):
-                for name in files:
-                    if name == 'm5.cpt':
-                        process_file(osp.join(root,name), **vars(options))
-                for dir in dirs:
-                    pass
+                if 'm5.cpb' in files:
+                    process_file(osp.join(root,'m5.cpb'), **vars(options))
+                elif 'm5.cpt' in files:
+                    process_file(osp.join(root,'m5.cpt'), **vars(options))
         # Maybe someone passed a cpt.XXXXXXX directory and not m5.cpt
         elif osp.isfile(cpt_file):
             process_file(cpt_file, **vars(options))
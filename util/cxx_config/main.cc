@@ -64,6 +64,7 @@
 #include "base/str.hh"
 #include "base/trace.hh"
 #include "cpu/base.hh"
+#include "sim/cxx_config_indexed.hh"
 #include "sim/cxx_config_ini.hh"
 #include "sim/cxx_manager.hh"
 #include "sim/init_signals.hh"
@@ -78,7 +79,9 @@ void
 usage(const std::string &prog_name)
 {
     std::cerr << "Usage: " << prog_name << (
-        " <config-file.ini> [ <option> ]\n\n"
+        " <config-file> [ <option> ]\n\n"
+        "The config file is either a config.ini or the file written by\n"
+        "gem5 --save-config.\n\n"
         "OPTIONS:\n"
         "    -p <object> <param> <value>  -- set a parameter\n"
         "    -v <object> <param> <values> -- set a vector parameter from"
@@ -124,11 +127,17 @@ main(int argc, char **argv)
 
     const std::string config_file(argv[arg_ptr]);
 
-    CxxConfigFileBase *conf = new CxxIniFile();
+    // Take the indexed file from --save-config if that is what we got
+    CxxConfigFileBase *conf = new CxxIndexedIniFile();
 
     if (!conf->load(config_file.c_str())) {
-        std::cerr << "Can't open config file: " << config_file << '\n';
-        return EXIT_FAILURE;
+        delete conf;
+        conf = new CxxIniFile();
+
+        if (!conf->load(config_file.c_str())) {
+            std::cerr << "Can't open config file: " << config_file << '\n';
+            return EXIT_FAILURE;
+        }
     }
     arg_ptr++;
 
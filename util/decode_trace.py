@@ -0,0 +1,462 @@
+#!/usr/bin/env python2
+#
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Renders a debug trace recorded with --debug-binary, or dumped by
+# --debug-ring, as the text gem5 would have printed without it:
+#
+#   decode_trace.py trace.bin [-o trace.txt]
+#
+# The formatting follows ccprintf (src/base/cprintf.cc), so the
+# output should match the text trace byte for byte, except for
+# arguments of class types that were not printed with %s.
+
+from __future__ import print_function
+
+import argparse
+import gzip
+import struct
+import sys
+
+MAGIC = b"gem5trc\0"
+VERSION = 1
+MAX_TICK = (1 << 64) - 1
+
+# See BinaryRecord::ArgType in src/base/trace.hh
+(ARG_END, ARG_INT, ARG_SIGNED, ARG_UNSIGNED, ARG_CHAR, ARG_UCHAR, ARG_BOOL,
+ ARG_FLOAT, ARG_STRING, ARG_POINTER, ARG_OTHER) = range(11)
+
+INTEGERS = (ARG_INT, ARG_SIGNED, ARG_UNSIGNED, ARG_CHAR, ARG_UCHAR,
+            ARG_BOOL)
+
+class Reader(object):
+    def __init__(self, f):
+        self.f = f
+
+    def read(self, size):
+        data = self.f.read(size)
+        if len(data) != size:
+            raise EOFError
+        return data
+
+    def unpack(self, fmt):
+        fmt = "=" + fmt
+        return struct.unpack(fmt, self.read(struct.calcsize(fmt)))
+
+    def string(self):
+        size, = self.unpack("I")
+        return self.read(size)
+
+class Spec(object):
+    """A conversion of a format string, see cp::Format"""
+
+    def __init__(self):
+        self.alternate = False
+        self.left = False
+        self.sign = False
+        self.zero = False
+        self.upper = False
+        self.base = 10
+        self.kind = None
+        self.float_format = "g"
+        self.precision = -1
+        self.width = 0
+        self.star_width = False
+        self.star_precision = False
+
+def parse_spec(fmt, i):
+    """Parse the conversion starting after the '%' at fmt[i], like
+    cp::Print::process_flag(). Returns the spec and the index after it."""
+
+    spec = Spec()
+    number = 0
+    end_number = False
+    have_precision = False
+    while True:
+        i += 1
+        c = fmt[i:i + 1]
+        if c.isdigit():
+            if end_number:
+                continue
+        elif number > 0:
+            end_number = True
+
+        done = True
+        if c == "s":
+            spec.kind = "s"
+        elif c == "c":
+            spec.kind = "c"
+        elif c == "l":
+            continue
+        elif c == "p":
+            spec.kind, spec.base, spec.alternate = "d", 16, True
+        elif c in "xX" and c:
+            spec.kind, spec.base, spec.upper = "d", 16, c == "X"
+        elif c == "o":
+            spec.kind, spec.base = "d", 8
+        elif c in "diu" and c:
+            spec.kind = "d"
+        elif c in "gGeEf" and c:
+            spec.kind = "f"
+            spec.upper = c.isupper()
+            spec.float_format = c.lower()
+        elif c == "n":
+            spec.kind = "n"
+        else:
+            done = False
+            if c == "#":
+                spec.alternate = True
+            elif c == "-":
+                spec.left = True
+            elif c == "+":
+                spec.sign = True
+            elif c == " ":
+                pass
+            elif c == ".":
+                spec.width = number
+                spec.precision = 0
+                have_precision = True
+                number = 0
+                end_number = False
+            elif c == "0" and number == 0:
+                spec.zero = True
+            elif c.isdigit():
+                number = number * 10 + int(c)
+            elif c == "*":
+                if have_precision:
+                    spec.star_precision = True
+                else:
+                    spec.star_width = True
+            else:
+                # Unknown conversion (or the end of the string)
+                done = True
+
+        if end_number:
+            if have_precision:
+                spec.precision = number
+            else:
+                spec.width = number
+            end_number = False
+            number = 0
+
+        if done:
+            if spec.kind == "d" and have_precision:
+                spec.width = spec.precision
+                spec.zero = True
+            elif spec.kind == "f" and not have_precision and spec.zero:
+                spec.precision = spec.width
+            return spec, i + 1
+
+def pad(text, width, fill, left):
+    """Pad like an ostream with the given width, fill and adjustment"""
+    if len(text) >= width:
+        return text
+    if left:
+        return text + fill * (width - len(text))
+    return fill * (width - len(text)) + text
+
+class Stream(object):
+    """The state ccprintf leaves behind in its ostream between the
+    conversions of a message"""
+
+    def __init__(self):
+        self.precision = 6
+
+def float_text(value, fmt, precision, upper=False):
+    text = "%.*{0}".format(fmt) % (precision, value)
+    return text.upper() if upper else text
+
+def text_of(arg, precision):
+    """The text an argument prints with operator<<"""
+    kind, value = arg[:2]
+    if kind in (ARG_STRING, ARG_OTHER):
+        return value
+    if kind == ARG_CHAR or kind == ARG_UCHAR:
+        return chr(value & 0xff)
+    if kind == ARG_FLOAT:
+        return float_text(value, "g", precision)
+    if kind == ARG_POINTER:
+        return "0x%x" % value if value else "0"
+    return str(value)
+
+def format_integer(arg, spec, stream):
+    """See cp::_format_integer()"""
+    kind, value = arg[:2]
+    prefix = ""
+    width = spec.width
+    if spec.alternate and spec.zero:
+        # Printed before the padding
+        if spec.base == 16:
+            prefix = "0x"
+            width -= 2
+        elif spec.base == 8:
+            prefix = "0"
+            width -= 1
+    fill = "0" if spec.zero else " "
+    left = spec.left and not spec.zero
+
+    if kind not in INTEGERS:
+        # Only the width and showpos apply to other types
+        text = text_of(arg, stream.precision)
+        if kind == ARG_FLOAT:
+            if spec.upper:
+                text = text.upper()
+            if spec.sign and not text.startswith("-"):
+                text = "+" + text
+        return prefix + pad(text, width, fill, left)
+
+    if spec.base == 10:
+        text = str(value)
+        if spec.sign and value >= 0 and kind != ARG_UNSIGNED:
+            text = "+" + text
+    else:
+        if value < 0:
+            # Printed as the unsigned type of the same size, chars are
+            # promoted to int
+            size = arg[2] if kind == ARG_SIGNED else 4
+            value += 1 << (8 * size)
+        text = ("%x" if spec.base == 16 else "%o") % value
+        if spec.alternate and not spec.zero and value != 0:
+            text = ("0x" if spec.base == 16 else "0") + text
+        if spec.upper:
+            text = text.upper()
+    return prefix + pad(text, width, fill, left)
+
+def format_float(value, spec, stream):
+    """See cp::_format_float()"""
+    fmt = "g"
+    upper = False
+    if spec.float_format == "e":
+        if spec.precision == 0:
+            # cprintf prints these in the default notation
+            stream.precision = 1
+        elif spec.precision != -1:
+            fmt = "e"
+            stream.precision = spec.precision
+        upper = spec.upper
+    elif spec.float_format == "f":
+        if spec.precision != -1:
+            fmt = "f"
+            stream.precision = spec.precision
+    elif spec.precision != -1:
+        stream.precision = spec.precision
+
+    text = float_text(value, fmt, stream.precision, upper)
+    return pad(text, spec.width, "0" if spec.zero else " ", False)
+
+def format_string(arg, spec, stream):
+    """See cp::_format_string()"""
+    if spec.width > 0:
+        # Measured with a fresh stringstream
+        text = text_of(arg, 6)
+        if spec.width > len(text):
+            return pad(text, spec.width, " ", spec.left)
+    return text_of(arg, stream.precision)
+
+def format_arg(arg, spec, stream):
+    kind, value = arg[:2]
+    if spec.kind == "c":
+        if kind == ARG_BOOL or kind not in INTEGERS:
+            return "<bad arg type for char format>"
+        return chr(value & 0xff)
+    if spec.kind == "d":
+        return format_integer(arg, spec, stream)
+    if spec.kind == "f":
+        if kind != ARG_FLOAT:
+            return "<bad arg type for float format>"
+        return format_float(value, spec, stream)
+    if spec.kind == "s":
+        return format_string(arg, spec, stream)
+    if spec.kind == "n":
+        return "we don't do %n!!!\n"
+    return "<bad format>"
+
+def literal(fmt, i, out, end):
+    """Copy the text of fmt from i up to the next conversion, or to
+    the end after the last argument. See cp::Print::process()"""
+    while i < len(fmt):
+        c = fmt[i]
+        if c == "%":
+            if fmt[i + 1:i + 2] != "%":
+                if not end:
+                    return i
+                out.append("<extra arg>")
+            out.append("%")
+            i += 2
+        elif c == "\r":
+            i += 1
+            if fmt[i:i + 1] != "\n":
+                out.append("\n")
+        else:
+            out.append(c)
+            i += 1
+    return i
+
+def render(fmt, args):
+    """Format args like ccprintf(fmt, args...)"""
+    out = []
+    stream = Stream()
+    spec = Spec()
+    i = 0
+    # Like cp::Print, a '*' makes all the following arguments use the
+    # same conversion
+    cont = False
+    for arg in args:
+        if not cont:
+            spec = Spec()
+            i = literal(fmt, i, out, False)
+            if i < len(fmt):
+                spec, i = parse_spec(fmt, i)
+        if spec.star_width or spec.star_precision:
+            number = arg[1] if arg[0] == ARG_INT else 0
+            if spec.star_width:
+                spec.star_width = False
+                spec.width = number
+            else:
+                spec.star_precision = False
+                spec.precision = number
+            cont = True
+            continue
+        out.append(format_arg(arg, spec, stream))
+    literal(fmt, i, out, True)
+    return "".join(out)
+
+def hexdump(data):
+    """The lines Trace::Logger::dump() prints for data"""
+    lines = []
+    for i in range(0, len(data), 16):
+        chunk = bytearray(data[i:i + 16])
+        line = "%08x  " % i
+        for j, b in enumerate(chunk):
+            line += "%02x " % b
+            if (j & 0xf) == 7 and j > 0:
+                line += " "
+        line += "   " * (16 - len(chunk)) + "  "
+        for b in chunk:
+            ch = b & 0x7f
+            line += chr(ch) if 32 <= ch < 127 else " "
+        lines.append(line + "\n")
+    return lines
+
+def read_args(r):
+    args = []
+    while True:
+        kind, = r.unpack("B")
+        if kind == ARG_END:
+            return args
+        if kind == ARG_SIGNED:
+            size, value = r.unpack("Bq")
+            args.append((kind, value, size))
+            continue
+        if kind == ARG_INT:
+            value, = r.unpack("q")
+        elif kind in (ARG_UNSIGNED, ARG_POINTER):
+            value, = r.unpack("Q")
+        elif kind == ARG_CHAR:
+            value, = r.unpack("b")
+        elif kind in (ARG_UCHAR, ARG_BOOL):
+            value, = r.unpack("B")
+        elif kind == ARG_FLOAT:
+            value, = r.unpack("d")
+        elif kind in (ARG_STRING, ARG_OTHER):
+            value = r.string().decode("latin-1")
+        else:
+            raise ValueError("unknown argument type %d" % kind)
+        args.append((kind, value, None))
+
+def open_trace(path):
+    f = open(path, "rb")
+    if f.read(2) == b"\x1f\x8b":
+        f.close()
+        f = gzip.open(path, "rb")
+    else:
+        f.seek(0)
+    return f
+
+def messages(path):
+    """Yield the (tick, name, text) of each message in a trace"""
+
+    with open_trace(path) as f:
+        r = Reader(f)
+        magic, version, order = r.unpack("8sII")
+        if magic != MAGIC:
+            raise ValueError("%s is not a binary trace" % path)
+        if version != VERSION or order != 0x01020304:
+            raise ValueError("%s: unsupported trace version or byte order" %
+                             path)
+
+        names = []
+        formats = []
+        while True:
+            tag = f.read(1)
+            if not tag:
+                return
+            try:
+                if tag == b"N":
+                    r.unpack("I")
+                    names.append(r.string().decode("latin-1"))
+                elif tag == b"F":
+                    r.unpack("I")
+                    formats.append(r.string().decode("latin-1"))
+                elif tag == b"M":
+                    tick, name, fmt = r.unpack("QII")
+                    yield tick, names[name], render(formats[fmt],
+                                                    read_args(r))
+                elif tag == b"T":
+                    tick, name = r.unpack("QI")
+                    yield tick, names[name], r.string().decode("latin-1")
+                elif tag == b"D":
+                    tick, name = r.unpack("QI")
+                    for line in hexdump(r.string()):
+                        yield tick, names[name], line
+                else:
+                    raise ValueError("%s: corrupt record" % path)
+            except EOFError:
+                # The simulator did not get to write the whole record
+                return
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Render a binary debug trace as text")
+    parser.add_argument("input", help="trace recorded with --debug-binary")
+    parser.add_argument("-o", "--output", help="output file [stdout]")
+    args = parser.parse_args()
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    try:
+        for tick, name, text in messages(args.input):
+            if tick != MAX_TICK:
+                out.write("%7d: " % tick)
+            if name:
+                out.write(name + ": ")
+            out.write(text)
+    except IOError:
+        # Output piped into head and the like
+        pass
+
+if __name__ == "__main__":
+    main()
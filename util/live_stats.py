@@ -0,0 +1,169 @@
+#!/usr/bin/env python2
+#
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Reader for the live statistics a simulation publishes in shared
+# memory when started with --stats-live=NAME. List the running jobs:
+#
+#   live_stats.py list
+#
+# or show all the values of one of them, refreshing every 5 seconds:
+#
+#   live_stats.py -w 5 show NAME
+
+from __future__ import print_function
+
+import argparse
+import mmap
+import os
+import struct
+import sys
+import time
+
+SHM_DIR = "/dev/shm"
+MAGIC = b"gem5liv\0"
+VERSION = 1
+
+# See LiveHeader in src/sim/live_stats.cc
+HEADER = struct.Struct("=8sIIIIQQQdd")
+SEQ_OFFSET = 24
+
+class Segment(object):
+    """The stats published by a simulation"""
+
+    def __init__(self, name):
+        self.name = name.lstrip("/")
+        path = os.path.join(SHM_DIR, self.name)
+        with open(path, "rb") as f:
+            self.map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        if len(self.map) < HEADER.size or \
+           self.map[:len(MAGIC)] != MAGIC:
+            raise ValueError("%s is not a live stats segment" % name)
+        self.read()
+
+    def _seq(self):
+        return struct.unpack_from("=Q", self.map, SEQ_OFFSET)[0]
+
+    def read(self):
+        """Take a consistent snapshot of the values"""
+
+        while True:
+            before = self._seq()
+            if before & 1:
+                # The simulator is in the middle of an update
+                time.sleep(0.001)
+                continue
+            (magic, version, count, names_size, self.pid, seq,
+             self.updates, self.tick, self.start, self.time) = \
+                HEADER.unpack_from(self.map, 0)
+            if version != VERSION:
+                raise ValueError("%s: unsupported version %d" %
+                                 (self.name, version))
+            names = self.map[HEADER.size:HEADER.size + names_size]
+            values = struct.unpack_from("=%dd" % count, self.map,
+                                        HEADER.size + names_size)
+            if self._seq() == before:
+                break
+
+        self.names = [ n.decode("utf-8")
+                       for n in names.split(b"\0")[:count] ]
+        self.values = values
+        return self
+
+    def alive(self):
+        try:
+            os.kill(self.pid, 0)
+        except OSError:
+            return False
+        return True
+
+    def get(self, name, default=None):
+        try:
+            return self.values[self.names.index(name)]
+        except ValueError:
+            return default
+
+def segments():
+    for name in sorted(os.listdir(SHM_DIR)):
+        try:
+            yield Segment(name)
+        except (IOError, OSError, ValueError):
+            continue
+
+def fmt(value):
+    if value is None:
+        return "-"
+    if value != value or value in (float("inf"), float("-inf")):
+        return str(value)
+    if value == int(value):
+        return "%.0f" % value
+    return "%.6g" % value
+
+def show_list(args):
+    print("%-24s %8s %5s %8s %16s %12s %20s" %
+          ("name", "pid", "alive", "age(s)", "sim_insts", "host_ips",
+           "tick"))
+    now = time.time()
+    for seg in segments():
+        print("%-24s %8d %5s %8.1f %16s %12s %20d" %
+              (seg.name, seg.pid, "yes" if seg.alive() else "no",
+               now - seg.time, fmt(seg.get("sim_insts")),
+               fmt(seg.get("host_ips")), seg.tick))
+
+def show_one(args):
+    seg = Segment(args.name)
+    print("%s: pid %d, %d updates, tick %d, %.1f s ago" %
+          (seg.name, seg.pid, seg.updates, seg.tick, time.time() - seg.time))
+    width = max(len(n) for n in seg.names)
+    for name, value in zip(seg.names, seg.values):
+        print("%-*s %16s" % (width, name, fmt(value)))
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Show the live statistics of running simulations")
+    parser.add_argument("-w", "--watch", type=float, metavar="SECONDS",
+                        help="refresh every SECONDS")
+    sub = parser.add_subparsers(dest="command")
+    sub.required = True
+    sub.add_parser("list", help="list the running simulations")
+    show = sub.add_parser("show", help="show the stats of a simulation")
+    show.add_argument("name", help="segment name given to --stats-live")
+    args = parser.parse_args()
+
+    action = show_list if args.command == "list" else show_one
+    while True:
+        if args.watch:
+            # Clear the terminal
+            sys.stdout.write("\033[H\033[2J")
+        action(args)
+        if not args.watch:
+            break
+        sys.stdout.flush()
+        time.sleep(args.watch)
+
+if __name__ == "__main__":
+    main()
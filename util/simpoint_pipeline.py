@@ -0,0 +1,294 @@
+#!/usr/bin/env python2
+#
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Runs the whole SimPoint flow with a gem5 binary and a config script
+# that takes the common options (se.py or fs.py):
+#
+#   simpoint_pipeline.py run -d sp -j 8 --detailed="--cpu-type=DerivO3CPU \
+#       --caches --l2cache" build/X86/gem5.opt configs/example/se.py \
+#       --cmd=...
+#
+# 1. profile: an atomic run collects the BBVs and clusters them into
+#    SimPoints as it exits (--simpoint-max-k).
+# 2. checkpoint: a second atomic run takes the checkpoints of all the
+#    SimPoints, each warmup instructions before its interval.
+# 3. run: the detailed simulations of the checkpoints, in parallel.
+# 4. report: the weighted CPI/IPC and TyCHE capability overheads,
+#    written to simpoint_report.txt. Only this step is done by
+#
+#   simpoint_pipeline.py report sp
+
+from __future__ import print_function
+
+import argparse
+import multiprocessing
+import multiprocessing.pool
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+STAGES = [ "profile", "checkpoint", "run", "report" ]
+
+# Checkpoint directory names, see takeSimpointCheckpoints() in
+# configs/common/Simulation.py
+CPT_RE = re.compile(r"cpt\.simpoint_(\d+)_inst_(\d+)"
+                    r"_weight_([\d\.e\-]+)_interval_(\d+)_warmup_(\d+)")
+
+def checkpoints(cpt_dir):
+    """The SimPoint checkpoints, in the order -r numbers them"""
+
+    cpts = []
+    for name in sorted(os.listdir(cpt_dir)):
+        m = CPT_RE.match(name)
+        if m:
+            cpts.append((name, int(m.group(1)), int(m.group(2)),
+                         float(m.group(3))))
+    return cpts
+
+def gem5(args, outdir, config_args):
+    cmd = [ args.gem5, "-r", "-e", "-d", outdir, args.config ] + \
+          args.config_args + config_args
+    print(" ".join(cmd))
+    return subprocess.call(cmd)
+
+def profile(args):
+    status = gem5(args, args.profile_dir, [
+        "--cpu-type=AtomicSimpleCPU",
+        "--simpoint-profile",
+        "--simpoint-interval=%d" % args.interval,
+        "--simpoint-max-k=%d" % args.max_k ])
+    if status:
+        sys.exit("Profiling failed, see %s" % args.profile_dir)
+
+def checkpoint(args):
+    analysis = ",".join([
+        os.path.join(args.profile_dir, "simpoint.simpts"),
+        os.path.join(args.profile_dir, "simpoint.weights"),
+        str(args.interval), str(args.warmup) ])
+    status = gem5(args, args.cpt_dir, [
+        "--cpu-type=AtomicSimpleCPU",
+        "--take-simpoint-checkpoints=%s" % analysis,
+        "--checkpoint-dir=%s" % args.cpt_dir ])
+    if status:
+        sys.exit("Taking the checkpoints failed, see %s" % args.cpt_dir)
+
+def run_dir(outdir, index):
+    return os.path.join(outdir, "run.%02d" % index)
+
+def run(args):
+    detailed = shlex.split(args.detailed)
+
+    def run_one(cpt):
+        num = cpt + 1
+        return gem5(args, run_dir(args.outdir, num), detailed + [
+            "--restore-simpoint-checkpoint",
+            "--checkpoint-restore=%d" % num,
+            "--checkpoint-dir=%s" % args.cpt_dir ])
+
+    cpts = checkpoints(args.cpt_dir)
+    if not cpts:
+        sys.exit("No SimPoint checkpoints in %s" % args.cpt_dir)
+    pool = multiprocessing.pool.ThreadPool(args.jobs)
+    statuses = pool.map(run_one, range(len(cpts)))
+    pool.close()
+    for (name, index, start, weight), status in zip(cpts, statuses):
+        if status:
+            print("warning: simulation of %s exited with status %d" %
+                  (name, status), file=sys.stderr)
+
+def last_dump(path):
+    """The values of the last stats dump in a stats.txt file"""
+
+    stats = {}
+    with open(path) as f:
+        for line in f:
+            if line.startswith("---------- Begin"):
+                stats = {}
+                continue
+            fields = line.split()
+            if len(fields) < 2 or fields[0].startswith("-"):
+                continue
+            try:
+                stats[fields[0]] = float(fields[1])
+            except ValueError:
+                pass
+    return stats
+
+def measured_cpu(stats):
+    """Name of the CPU that ran the sample, the one with most insts"""
+
+    best, best_insts = None, 0
+    for name, value in stats.items():
+        if name.endswith(".committedInsts") and value > best_insts:
+            cpu = name[:-len(".committedInsts")]
+            if cpu + ".numCycles" in stats:
+                best, best_insts = cpu, value
+    return best
+
+class Sample(object):
+    def __init__(self, cpt, stats_file):
+        self.name, self.index, self.start, self.weight = cpt
+        stats = last_dump(stats_file)
+        cpu = measured_cpu(stats)
+        if cpu is None:
+            raise ValueError("no committed instructions")
+        self.insts = stats[cpu + ".committedInsts"]
+        self.cycles = stats[cpu + ".numCycles"]
+        self.cpi = self.cycles / self.insts
+
+        # TyCHE capability stats of the CPU, with the CPU name dropped
+        # so that they match up across samples
+        self.capability = {}
+        for name, value in stats.items():
+            if name.startswith(cpu + ".") and \
+               "capability" in name.lower() and value == value:
+                self.capability[name[len(cpu) + 1:]] = value
+
+    def cap(self, *suffixes):
+        return sum(v for n, v in self.capability.items()
+                   if n.split(".")[-1] in suffixes)
+
+CAP_MICROOPS = ("numOfCapabilityGenMicroops", "numOfCapabilityFreeMicroops",
+                "numOfCapabilityCheckMicroops")
+CAP_STALLS = ("lsqLoadCapabilityCyclesStalled",
+              "lsqStoreCapabilityCyclesStalled")
+
+def weighted(samples, value):
+    total = sum(s.weight for s in samples)
+    return sum(s.weight * value(s) for s in samples) / total
+
+def report(args):
+    samples = []
+    missing = 0
+    for i, cpt in enumerate(checkpoints(args.cpt_dir)):
+        name = cpt[0]
+        stats_file = os.path.join(run_dir(args.outdir, i + 1), "stats.txt")
+        try:
+            samples.append(Sample(cpt, stats_file))
+        except (IOError, ValueError) as e:
+            print("warning: skipping %s: %s" % (name, e), file=sys.stderr)
+            missing += 1
+    if not samples:
+        sys.exit("No SimPoint simulation results in %s" % args.outdir)
+
+    lines = []
+    lines.append("%-8s %14s %10s %14s %8s" %
+                 ("simpoint", "start inst", "weight", "insts", "CPI"))
+    for s in samples:
+        lines.append("%-8d %14d %10.6f %14d %8.4f" %
+                     (s.index, s.start, s.weight, s.insts, s.cpi))
+    lines.append("")
+
+    # Each sample stands for weight of the instructions, so the CPIs
+    # average by weight and the IPC follows from the average CPI
+    cpi = weighted(samples, lambda s: s.cpi)
+    covered = sum(s.weight for s in samples)
+    lines.append("samples             %d (%d missing)" %
+                 (len(samples), missing))
+    lines.append("weight covered      %.6f" % covered)
+    lines.append("weighted CPI        %.6f" % cpi)
+    lines.append("weighted IPC        %.6f" % (1.0 / cpi))
+
+    names = set()
+    for s in samples:
+        names.update(s.capability)
+    if names:
+        lines.append("")
+        lines.append("TyCHE overheads (weighted)")
+        lines.append("capability uops/inst %.6f" % weighted(samples,
+            lambda s: s.cap(*CAP_MICROOPS) / s.insts))
+        lines.append("capability stall cycles %.4f%%" % weighted(samples,
+            lambda s: 100.0 * s.cap(*CAP_STALLS) / s.cycles))
+        lines.append("")
+        lines.append("%-64s %14s" % ("capability stat", "per 1k insts"))
+        for name in sorted(names):
+            if name.split(".")[-1].endswith("Rate"):
+                continue
+            value = weighted(samples,
+                lambda s: 1000.0 * s.capability.get(name, 0.0) / s.insts)
+            lines.append("%-64s %14.4f" % (name, value))
+
+    text = "\n".join(lines) + "\n"
+    sys.stdout.write(text)
+    with open(os.path.join(args.outdir, "simpoint_report.txt"), "w") as f:
+        f.write(text)
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run the SimPoint flow and report weighted results")
+    sub = parser.add_subparsers(dest="command")
+    sub.required = True
+
+    run_parser = sub.add_parser("run", help="run the flow")
+    run_parser.add_argument("-d", "--outdir", default="simpoint",
+                            help="output directory [default: %(default)s]")
+    run_parser.add_argument("--interval", type=int, default=10000000,
+                            help="interval length in instructions "
+                            "[default: %(default)s]")
+    run_parser.add_argument("--warmup", type=int, default=1000000,
+                            help="warmup instructions before each SimPoint "
+                            "[default: %(default)s]")
+    run_parser.add_argument("--max-k", type=int, default=30,
+                            help="maximum number of SimPoints "
+                            "[default: %(default)s]")
+    run_parser.add_argument("-j", "--jobs", type=int,
+                            default=multiprocessing.cpu_count(),
+                            help="detailed simulations to run at once "
+                            "[default: %(default)s]")
+    run_parser.add_argument("--detailed", default="",
+                            help="extra config options of the detailed "
+                            "simulations, e.g. the CPU type")
+    run_parser.add_argument("--start", choices=STAGES, default=STAGES[0],
+                            help="stage to start from, the results of the "
+                            "ones before it are reused")
+    run_parser.add_argument("gem5", help="gem5 binary")
+    run_parser.add_argument("config", help="config script")
+    run_parser.add_argument("config_args", nargs=argparse.REMAINDER,
+                            help="options of the config script")
+
+    report_parser = sub.add_parser("report",
+                                   help="report the results of a run")
+    report_parser.add_argument("outdir", help="output directory of the run")
+
+    args = parser.parse_args()
+    args.profile_dir = os.path.join(args.outdir, "profile")
+    args.cpt_dir = os.path.join(args.outdir, "checkpoints")
+
+    if args.command == "report":
+        report(args)
+        return
+
+    stages = STAGES[STAGES.index(args.start):]
+    for stage, action in zip(STAGES, [ profile, checkpoint, run, report ]):
+        if stage in stages:
+            action(args)
+
+if __name__ == "__main__":
+    main()
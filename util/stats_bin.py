@@ -0,0 +1,555 @@
+#!/usr/bin/env python2
+#
+# Copyright (c) 2026 The TyCHE Project
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Reader for the binary statistics files written by Stats::Binary
+# (--stats-file=binary://stats.bin). As a module it loads the dumps into
+# numpy arrays or a pandas DataFrame:
+#
+#   import stats_bin
+#   df = stats_bin.load("m5out/stats.bin")
+#   df["sim_insts"].diff()
+#
+# As a script it converts a file back to the stats.txt format:
+#
+#   stats_bin.py m5out/stats.bin -o stats.txt
+
+from __future__ import print_function
+
+import argparse
+import array
+import math
+import struct
+import sys
+import zlib
+
+MAGIC = b"gem5stb\0"
+VERSION = 1
+
+SCALAR, VECTOR, DIST, VECTOR_DIST, VECTOR_2D, FORMULA, SPARSE_HIST = range(7)
+DEVIATION, DISTRIBUTION, HIST = range(3)
+
+# Stat flags, see base/stats/info.hh
+F_TOTAL = 0x0010
+F_PDF = 0x0020
+F_CDF = 0x0040
+F_NOZERO = 0x0100
+F_NONAN = 0x0200
+F_ONELINE = 0x0400
+
+NAN = float("nan")
+
+# Value columns taken by a distribution in front of its buckets
+DIST_FIELDS = ("samples", "sum", "squares", "logs", "min_value",
+               "max_value", "underflows", "overflows")
+
+class Reader(object):
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def unpack(self, fmt):
+        vals = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += struct.calcsize(fmt)
+        return vals
+
+    def one(self, fmt):
+        return self.unpack(fmt)[0]
+
+    def string(self):
+        size = self.one("=I")
+        s = self.data[self.pos:self.pos + size]
+        self.pos += size
+        return s.decode("utf-8")
+
+    def strings(self):
+        return [ self.string() for i in range(self.one("=I")) ]
+
+    def dist_params(self):
+        kind, lo, hi, bucket_size, buckets = self.unpack("=BdddI")
+        return dict(type=kind, min=lo, max=hi, bucket_size=bucket_size,
+                    buckets=buckets)
+
+class Stat(object):
+    """Dictionary entry of a stat"""
+
+    def __init__(self, r):
+        self.kind = r.one("=B")
+        self.name = r.string()
+        self.desc = r.string()
+        self.flags = r.one("=H")
+        self.precision = r.one("=i")
+        self.has_prereq = bool(r.one("=B"))
+        self.columns = r.one("=I")
+        self.subnames = []
+        self.subdescs = []
+        self.y_subnames = []
+        self.dists = []
+
+        if self.kind in (VECTOR, FORMULA):
+            self.size = r.one("=I")
+            self.subnames = r.strings()
+            self.subdescs = r.strings()
+        elif self.kind == VECTOR_2D:
+            self.x, self.y = r.unpack("=II")
+            self.subnames = r.strings()
+            self.subdescs = r.strings()
+            self.y_subnames = r.strings()
+        elif self.kind == DIST:
+            self.dists = [ r.dist_params() ]
+        elif self.kind == VECTOR_DIST:
+            self.size = r.one("=I")
+            self.subnames = r.strings()
+            self.subdescs = r.strings()
+            self.dists = [ r.dist_params() for i in range(self.size) ]
+
+class Dump(object):
+    """Values of the stats in one dump"""
+
+    def __init__(self, stats, values, sparse):
+        self.stats = stats
+        self.values = values
+        self.sparse = sparse
+
+def _open(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] == b"\x1f\x8b":
+        # The simulator may still be running, or not have closed the
+        # file, so don't insist on the end of the stream.
+        data = zlib.decompressobj(16 + zlib.MAX_WBITS).decompress(data)
+    return data
+
+def _doubles(data):
+    vals = array.array("d")
+    if hasattr(vals, "frombytes"):
+        vals.frombytes(data)
+    else:
+        vals.fromstring(data)
+    return vals
+
+def dumps(path):
+    """Iterate over the dumps in a file"""
+
+    data = _open(path)
+    r = Reader(data)
+    if r.data[:len(MAGIC)] != MAGIC:
+        raise ValueError("%s: not a binary stats file" % path)
+    r.pos = len(MAGIC)
+    version, order = r.unpack("=II")
+    if order != 0x01020304:
+        raise ValueError("%s: written with a different byte order" % path)
+    if version != VERSION:
+        raise ValueError("%s: unsupported version %d" % (path, version))
+
+    stats = None
+    while r.pos + 9 <= len(data):
+        tag, size = r.unpack("=cQ")
+        end = r.pos + size
+        if end > len(data):
+            # Truncated by a crash, ignore the partial record
+            break
+        if tag == b"D":
+            separator = r.string()
+            stats = [ Stat(r) for i in range(r.one("=I")) ]
+            for stat in stats:
+                stat.separator = separator
+        elif tag == b"R":
+            ncols = sum(s.columns for s in stats)
+            values = _doubles(data[r.pos:r.pos + ncols * 8])
+            sparse = _doubles(data[r.pos + ncols * 8:end])
+            yield Dump(stats, values, sparse)
+        r.pos = end
+
+def _bucket_names(params):
+    names = []
+    for i in range(params["buckets"]):
+        low = i * params["bucket_size"] + params["min"]
+        high = min(low + params["bucket_size"] - 1.0, params["max"])
+        name = "%g" % low
+        if low < high:
+            name += "-%g" % high
+        names.append(name)
+    return names
+
+def column_names(stats):
+    """Names of the value columns of a dictionary"""
+
+    names = []
+    for stat in stats:
+        base = stat.name + stat.separator
+        if stat.has_prereq:
+            names.append(base + "prereq_zero")
+
+        if stat.kind == SCALAR:
+            names.append(stat.name)
+        elif stat.kind in (VECTOR, FORMULA):
+            for i in range(stat.columns - 1 - stat.has_prereq):
+                sub = stat.subnames[i] if i < len(stat.subnames) else ""
+                names.append(base + (sub or str(i)))
+            names.append(base + "total")
+        elif stat.kind == VECTOR_2D:
+            for i in range(stat.x):
+                for j in range(stat.y):
+                    names.append("%s_%d%s%d" % (stat.name, i, stat.separator,
+                                                j))
+            names.append(base + "total")
+        elif stat.kind in (DIST, VECTOR_DIST):
+            for i, params in enumerate(stat.dists):
+                if stat.kind == VECTOR_DIST:
+                    sub = stat.subnames[i] if i < len(stat.subnames) else ""
+                    dbase = "%s_%s%s" % (stat.name, sub or str(i),
+                                         stat.separator)
+                else:
+                    dbase = base
+                names += [ dbase + f for f in DIST_FIELDS ]
+                names += [ dbase + b for b in _bucket_names(params) ]
+    return names
+
+def arrays(path):
+    """Load a file as a list of (column names, 2d array) pairs, one per
+    stat layout and with a row per dump"""
+
+    import numpy
+
+    segments = []
+    last = None
+    rows = []
+    for dump in dumps(path):
+        if dump.stats is not last:
+            if rows:
+                segments.append((column_names(last), numpy.array(rows)))
+            last = dump.stats
+            rows = []
+        rows.append(numpy.frombuffer(dump.values, dtype=numpy.float64))
+    if rows:
+        segments.append((column_names(last), numpy.array(rows)))
+    return segments
+
+def load(path):
+    """Load a file into a pandas DataFrame with a row per dump"""
+
+    import pandas
+
+    frames = [ pandas.DataFrame(values, columns=names)
+               for names, values in arrays(path) ]
+    if not frames:
+        return pandas.DataFrame()
+    return pandas.concat(frames, ignore_index=True, sort=False)
+
+#
+# Conversion to text, following base/stats/text.cc
+#
+
+def _div(a, b):
+    if b:
+        return a / b
+    if a == 0 or math.isnan(a):
+        return NAN
+    return math.copysign(float("inf"), a)
+
+def _sqrt(a):
+    return math.sqrt(a) if a >= 0 else NAN
+
+def _exp(a):
+    try:
+        return math.exp(a)
+    except OverflowError:
+        return float("inf")
+
+def value_str(value, precision):
+    if math.isnan(value):
+        return "nan"
+    if math.isinf(value):
+        return "inf" if value > 0 else "-inf"
+    if precision == -1:
+        precision = 0 if value == math.floor(value) else 6
+    return "%.*f" % (precision, value)
+
+class ScalarPrint(object):
+    def __init__(self, out, desc, flags, precision, descriptions):
+        self.out = out
+        self.name = ""
+        self.desc = desc
+        self.flags = flags
+        self.precision = precision
+        self.descriptions = descriptions
+        self.value = 0.0
+        self.pdf = NAN
+        self.cdf = NAN
+
+    def update(self, val, total):
+        self.value = val
+        if total:
+            self.pdf = val / total
+            self.cdf += self.pdf
+
+    def __call__(self, one_line=False):
+        if (self.flags & F_NOZERO and not one_line and self.value == 0.0) or \
+           (self.flags & F_NONAN and math.isnan(self.value)):
+            return
+
+        pdf = "" if math.isnan(self.pdf) else "%.2f%%" % (self.pdf * 100.0)
+        cdf = "" if math.isnan(self.cdf) else "%.2f%%" % (self.cdf * 100.0)
+        value = value_str(self.value, self.precision)
+        if one_line:
+            self.out.write(" |%12s %10s %10s" % (value, pdf, cdf))
+        else:
+            self.out.write("%-40s %12s %10s %10s" %
+                           (self.name, value, pdf, cdf))
+            if self.descriptions and self.desc:
+                self.out.write(" # %s" % self.desc)
+            self.out.write("\n")
+
+def print_vector(out, stat, name, desc, flags, vec, total, subnames,
+                 subdescs, force_subnames, descriptions):
+    _total = sum(vec) if flags & (F_PDF | F_CDF) else 0.0
+    base = name + stat.separator
+
+    p = ScalarPrint(out, desc, flags, stat.precision, descriptions)
+    p.name = name
+    p.pdf = 0.0 if _total else NAN
+    p.cdf = 0.0 if _total else NAN
+
+    if len(vec) == 1:
+        if force_subnames:
+            p.name = base + (subnames[0] if subnames else "0")
+        p.value = vec[0]
+        p()
+        return
+
+    if not flags & F_NOZERO or total != 0:
+        if flags & F_ONELINE:
+            out.write("%-40s" % name)
+            p.flags &= ~F_NOZERO
+
+        for i, val in enumerate(vec):
+            if subnames and (i >= len(subnames) or not subnames[i]):
+                continue
+            p.name = base + (subnames[i] if subnames else str(i))
+            p.desc = subdescs[i] if subdescs else desc
+            p.update(val, _total)
+            p(flags & F_ONELINE)
+
+        if flags & F_ONELINE:
+            if descriptions and desc:
+                out.write(" # %s" % desc)
+            out.write("\n")
+
+    if flags & F_TOTAL:
+        p.pdf = NAN
+        p.cdf = NAN
+        p.name = base + "total"
+        p.desc = desc
+        p.value = total
+        p()
+
+def print_dist(out, stat, name, desc, params, vals, descriptions):
+    samples, sum_, squares, logs, min_val, max_val, underflow, overflow = \
+        vals[:8]
+    cvec = vals[8:]
+    flags = stat.flags
+    if flags & F_NOZERO and samples == 0:
+        return
+    base = name + stat.separator
+
+    p = ScalarPrint(out, desc, flags, stat.precision, descriptions)
+
+    def line(suffix, value):
+        p.name = base + suffix
+        p.value = value
+        p()
+
+    if flags & F_ONELINE:
+        line("bucket_size", params["bucket_size"])
+        line("min_bucket", params["min"])
+        line("max_bucket", params["max"])
+
+    line("samples", samples)
+    line("mean", _div(sum_, samples) if samples else NAN)
+    if params["type"] == HIST:
+        line("gmean", _exp(_div(logs, samples)) if samples else NAN)
+
+    stdev = NAN
+    if samples:
+        stdev = _sqrt(_div(samples * squares - sum_ * sum_,
+                           samples * (samples - 1.0)))
+    line("stdev", stdev)
+
+    if params["type"] == DEVIATION:
+        return
+
+    is_dist = params["type"] == DISTRIBUTION
+    total = sum(cvec)
+    if is_dist:
+        total += underflow + overflow
+
+    if total:
+        p.pdf = 0.0
+        p.cdf = 0.0
+
+    if is_dist:
+        p.name = base + "underflows"
+        p.update(underflow, total)
+        p()
+
+    if flags & F_ONELINE:
+        out.write("%-40s" % name)
+
+    for bucket, val in zip(_bucket_names(params), cvec):
+        p.name = base + bucket
+        p.update(val, total)
+        p(flags & F_ONELINE)
+
+    if flags & F_ONELINE:
+        if descriptions and desc:
+            out.write(" # %s" % desc)
+        out.write("\n")
+
+    if is_dist:
+        p.name = base + "overflows"
+        p.update(overflow, total)
+        p()
+
+    p.pdf = NAN
+    p.cdf = NAN
+
+    if is_dist:
+        line("min_value", min_val)
+        line("max_value", max_val)
+
+    line("total", total)
+
+def _resized(strs, size):
+    return (list(strs) + [""] * size)[:size]
+
+def print_stat(out, stat, vals, sparse, descriptions):
+    if stat.has_prereq:
+        if vals[0]:
+            return
+        vals = vals[1:]
+
+    if stat.kind == SCALAR:
+        p = ScalarPrint(out, stat.desc, stat.flags, stat.precision,
+                        descriptions)
+        p.name = stat.name
+        p.value = vals[0]
+        p()
+
+    elif stat.kind in (VECTOR, FORMULA):
+        size = len(vals) - 1
+        subnames = []
+        subdescs = []
+        if any(stat.subnames[:size]):
+            subnames = _resized(stat.subnames, size)
+            if any(n and d for n, d in zip(subnames, stat.subdescs)):
+                subdescs = _resized(stat.subdescs, size)
+        print_vector(out, stat, stat.name, stat.desc, stat.flags,
+                     vals[:size], vals[size], subnames, subdescs, False,
+                     descriptions)
+
+    elif stat.kind == VECTOR_2D:
+        y_subnames = stat.y_subnames if any(stat.y_subnames) else []
+        havesub = any(stat.subnames[:stat.x])
+        tot_vec = [ 0.0 ] * stat.y
+        for i in range(stat.x):
+            if havesub and (i >= len(stat.subnames) or not stat.subnames[i]):
+                continue
+            yvec = vals[i * stat.y:(i + 1) * stat.y]
+            for j, v in enumerate(yvec):
+                tot_vec[j] += v
+            name = "%s_%s" % (stat.name,
+                              stat.subnames[i] if havesub else str(i))
+            print_vector(out, stat, name, stat.desc, stat.flags, yvec,
+                         sum(yvec), y_subnames, [], True, descriptions)
+
+        if stat.flags & F_TOTAL and stat.x > 1:
+            print_vector(out, stat, stat.name, stat.desc,
+                         stat.flags & ~F_TOTAL, [ vals[-1] ], vals[-1],
+                         [ "total" ], [], True, descriptions)
+
+    elif stat.kind in (DIST, VECTOR_DIST):
+        pos = 0
+        for i, params in enumerate(stat.dists):
+            ncols = len(DIST_FIELDS) + params["buckets"]
+            name, desc = stat.name, stat.desc
+            if stat.kind == VECTOR_DIST:
+                subnames = _resized(stat.subnames, len(stat.dists))
+                subdescs = _resized(stat.subdescs, len(stat.dists))
+                name = "%s_%s" % (stat.name, subnames[i] or str(i))
+                desc = subdescs[i] or desc
+            print_dist(out, stat, name, desc, params, vals[pos:pos + ncols],
+                       descriptions)
+            pos += ncols
+
+    elif stat.kind == SPARSE_HIST:
+        count, samples = sparse[0], sparse[1]
+        p = ScalarPrint(out, stat.desc, stat.flags, stat.precision,
+                        descriptions)
+        base = stat.name + stat.separator
+        p.name = base + "samples"
+        p.value = samples
+        p()
+        for i in range(int(count)):
+            key, val = sparse[2 + 2 * i], sparse[3 + 2 * i]
+            p.name = base + "%g" % key
+            p.value = val
+            p()
+
+def to_text(path, out, descriptions=True):
+    """Write the dumps of a file in the stats.txt format"""
+
+    for dump in dumps(path):
+        out.write("\n---------- Begin Simulation Statistics ----------\n")
+        pos = 0
+        spos = 0
+        for stat in dump.stats:
+            vals = dump.values[pos:pos + stat.columns]
+            pos += stat.columns
+            sparse = None
+            if stat.kind == SPARSE_HIST:
+                count = int(dump.sparse[spos])
+                sparse = dump.sparse[spos:spos + 2 + 2 * count]
+                spos += 2 + 2 * count
+            print_stat(out, stat, vals, sparse, descriptions)
+        out.write("\n---------- End Simulation Statistics   ----------\n")
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a binary statistics file to text")
+    parser.add_argument("input", help="binary statistics file")
+    parser.add_argument("-o", "--output", default="-",
+                        help="output file [Default: stdout]")
+    parser.add_argument("--no-desc", action="store_true",
+                        help="leave out the stat descriptions")
+    args = parser.parse_args()
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    to_text(args.input, out, not args.no_desc)
+
+if __name__ == "__main__":
+    main()